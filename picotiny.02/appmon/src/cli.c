@@ -10,6 +10,15 @@
 #include "cli.h"
 #include "sysutils.h"
 #include "fb_graphics.h"
+#include "fbfont.h"
+#include "fb_glyphcache.h"
+#include "fb_console.h"
+#include "fb_sprite.h"
+#include "fb_overlay.h"
+#include "fb_surface.h"
+#include "dma.h"
+#include "memops.h"
+#include "cpumark.h"
 
 int errno;
 
@@ -34,6 +43,25 @@ int cmd_gsetcolor(int argc, char *argv[]);
 int cmd_msectest(int argc, char *argv[]);
 int cmd_gprinttext(int argc, char *argv[]);
 int cmd_drawrect(int argc, char *argv[]);
+int cmd_glyphcache(int argc, char *argv[]);
+int cmd_console(int argc, char *argv[]);
+int cmd_sprite(int argc, char *argv[]);
+int cmd_overlay(int argc, char *argv[]);
+int cmd_fbmode(int argc, char *argv[]);
+int cmd_arbiter(int argc, char *argv[]);
+int cmd_clip(int argc, char *argv[]);
+int cmd_surface(int argc, char *argv[]);
+int cmd_triangle(int argc, char *argv[]);
+int cmd_gradient(int argc, char *argv[]);
+int cmd_xblit(int argc, char *argv[]);
+int cmd_spans(int argc, char *argv[]);
+int cmd_dma(int argc, char *argv[]);
+int cmd_memops(int argc, char *argv[]);
+int cmd_membench(int argc, char *argv[]);
+int cmd_gbench(int argc, char *argv[]);
+#ifdef CPUMARK
+int cmd_cpumark(int argc, char *argv[]);
+#endif
 // clang-format off
 const CMD_ENTRY cmd_table[] = {
 	{ "?",		cmd_help			},
@@ -54,10 +82,36 @@ const CMD_ENTRY cmd_table[] = {
 	{ "color",	cmd_gsetcolor		},
 	{ "msec",	cmd_msectest		},
 	{ "tt",		cmd_gprinttext		},
+	{ "gcache",	cmd_glyphcache		},
+	{ "con",	cmd_console		},
+	{ "spr",	cmd_sprite			},
+	{ "ovl",	cmd_overlay			},
+	{ "fbmode",	cmd_fbmode			},
+	{ "arb",	cmd_arbiter			},
+	{ "clip",	cmd_clip			},
+	{ "surf",	cmd_surface			},
+	{ "tri",	cmd_triangle		},
+	{ "grad",	cmd_gradient		},
+	{ "xblit",	cmd_xblit			},
+	{ "spans",	cmd_spans			},
+	{ "dma",	cmd_dma				},
+	{ "memops",	cmd_memops			},
+	{ "membench",	cmd_membench		},
+	{ "gbench",	cmd_gbench			},
+#ifdef CPUMARK
+	{ "cpumark",	cmd_cpumark			},
+#endif
 	{ 0, 0 },
 };
 // clang-format on
 
+/* echo bypasses stdio, so mirror it to the framebuffer console too */
+static void cli_echo(char c)
+{
+	putchar_raw(c);
+	fbcon_write(&c, 1);
+}
+
 int nb_getline(void)
 {
 	int c = 0, esc = 0;
@@ -84,9 +138,9 @@ int nb_getline(void)
 			}
 			else {
 				if (kbuf_count > 0) {
-					putchar_raw(c);
-					putchar_raw(' ');
-					putchar_raw(c);
+					cli_echo(c);
+					cli_echo(' ');
+					cli_echo(c);
 					kbuf_count--;
 				}
 			}
@@ -102,7 +156,7 @@ int nb_getline(void)
 			}
 			else if (isprint(c) && (kbuf_count < CLI_KBUF_MAX - 1)) {
 				kbuf[kbuf_count++] = c;
-				putchar_raw(c);
+				cli_echo(c);
 			}
 			break;
 		}
@@ -480,7 +534,67 @@ int cmd_showmap(int argc, char *argv[])
 		   "    0x83000000 - 0x8300000F UART\n"
 		   "0xC0000000 - 0xFFFFFFFF Expansion region\n"
 		   "    0xC0000000 - 0xC07FFFFF PSRAM/LCD-FB\n"
-		   "    0xC0800000 - 0xC080002F LCD-FB registers\n");
+		   "    0xC1000000 - 0xC100007F LCD-FB registers\n"
+		   "    0xC1008000 - 0xC100CFFF LCD text layer cells (write-only)\n"
+		   "    0xC1010000 - 0xC1013FFF LCD sprite pixels (write-only)\n"
+		   "    0xC2000000 - 0xC200000F MyPeripherals\n"
+		   "    0xC3000000 - 0xC300001F DMA\n");
+	return 0;
+}
+
+/* GPU clear, fill and copy of a whole screen into the back buffer */
+static int gpu_bandwidth_test(void)
+{
+	uint32_t caps = *GPU_CAPS;
+	uint32_t bytes = (fb_width() * fb_height() * LCD_PIXELBYTES) >> fb_get_draw_depth();
+	uint32_t rgb_bytes = LCD_WIDTH * LCD_HEIGHT * LCD_PIXELBYTES;
+	uint32_t tmp_workaddr = lcd_regs->workaddr;
+	uint32_t start_msec, msecs;
+	const int rounds = 10;
+
+	printf("PSRAM burst %ld\n", GPU_CAP_BURST(caps) ? GPU_CAP_BURST(caps) : 16);
+	lcd_regs->workaddr = LCD_FBADDR2;
+	start_msec = systime_msec();
+	for (int i = 0; i < rounds; i++)
+		gpu_exec(GPU_SETBG);
+	msecs = systime_msec() - start_msec;
+	lcd_regs->workaddr = tmp_workaddr;
+	printf("clear: %ld.%ld msecs, %ld KB/s (%ld bytes)\n", msecs / rounds, msecs % rounds,
+		   msecs ? bytes / msecs * rounds : 0, bytes);
+
+	start_msec = systime_msec();
+	for (int i = 0; i < rounds; i++)
+		gpu_fill_rect(LCD_FBADDR2, 1, 0, LCD_WIDTH - 2, LCD_HEIGHT, lcd_regs->argb);
+	msecs = systime_msec() - start_msec;
+	printf("fill:  %ld.%ld msecs, %ld KB/s (x 1..%d, unaligned)\n", msecs / rounds,
+		   msecs % rounds, msecs ? rgb_bytes / msecs * rounds : 0, LCD_WIDTH - 2);
+
+	if (caps & GPU_CAP_BLIT) {
+		start_msec = systime_msec();
+		for (int i = 0; i < rounds; i++)
+			gpu_blit(LCD_FBADDR, 0, 0, LCD_FBADDR2, 0, 0, LCD_WIDTH, LCD_HEIGHT);
+		msecs = systime_msec() - start_msec;
+		printf("copy:  %ld.%ld msecs, %ld KB/s read + write\n", msecs / rounds,
+			   msecs % rounds, msecs ? 2 * (rgb_bytes / msecs) * rounds : 0);
+	}
+
+	if (caps & GPU_CAP_BLEND) {
+		/* KB/s of the area, to compare with fill and copy */
+		start_msec = systime_msec();
+		for (int i = 0; i < rounds; i++)
+			gpu_fill_rect_alpha(LCD_FBADDR2, 1, 0, LCD_WIDTH - 2, LCD_HEIGHT,
+								ARGB_ALPHA(lcd_regs->argb, 0x80));
+		msecs = systime_msec() - start_msec;
+		printf("blend fill: %ld.%ld msecs, %ld KB/s\n", msecs / rounds, msecs % rounds,
+			   msecs ? rgb_bytes / msecs * rounds : 0);
+
+		start_msec = systime_msec();
+		for (int i = 0; i < rounds; i++)
+			gpu_blit_alpha(LCD_FBADDR, 0, 0, LCD_FBADDR2, 0, 0, LCD_WIDTH, LCD_HEIGHT, 0x80);
+		msecs = systime_msec() - start_msec;
+		printf("blend copy: %ld.%ld msecs, %ld KB/s\n", msecs / rounds, msecs % rounds,
+			   msecs ? rgb_bytes / msecs * rounds : 0);
+	}
 	return 0;
 }
 
@@ -494,6 +608,8 @@ int cmd_gclearscreen(int argc, char *argv[])
 
 	if (anyopts(argc, argv, "-h") > 0)
 		goto usage;
+	if (anyopts(argc, argv, "-t") > 0)
+		return gpu_bandwidth_test();
 	if (anyopts(argc, argv, "-s") > 0)
 		use_sw = true;
 	if (anyopts(argc, argv, "-0") > 0)
@@ -539,6 +655,7 @@ int cmd_gclearscreen(int argc, char *argv[])
 	return 0;
 usage:
 	printf("Usage: %s [-0|-1] [-s] [ARGB in 32-bit hex | colorname]\n", argv[0]);
+	printf("       %s -t    time GPU clear, fill and copy of the back buffer\n", argv[0]);
 	return 0;
 }
 
@@ -549,18 +666,11 @@ int cmd_drawline(int argc, char *argv[])
 
 	if (argc < 5)
 		goto usage;
+	/* clipped per pixel, the ends may be off-screen */
 	x0 = strtol(argv[1], NULL, 0);
-	if (x0 < 0 || x0 >= LCD_WIDTH)
-		goto usage;
 	y0 = strtol(argv[2], NULL, 0);
-	if (y0 < 0 || y0 >= LCD_HEIGHT)
-		goto usage;
 	x1 = strtol(argv[3], NULL, 0);
-	if (x1 < 0 || x1 >= LCD_WIDTH)
-		goto usage;
 	y1 = strtol(argv[4], NULL, 0);
-	if (y1 < 0 || y1 >= LCD_HEIGHT)
-		goto usage;
 	if (argc > 5)
 		color = strtol(argv[5], NULL, 16);
 	printf("drawing line from (%d, %d) to (%d, %d) with 0x%04X\n",
@@ -572,6 +682,58 @@ usage:
 	return -1;
 }
 
+/* random points and lines with CPU stores and with the plot port */
+static int plot_port_test(void)
+{
+	const int npoints = 20000, nlines = 200;
+	uint32_t  argb = 0x00ffffff; /* white, palette index 255 */
+	uint32_t  seed = 1, start_msec, msecs, blocks, pixels;
+	bool	  was_on = plot_port_enabled();
+
+	if (fb_get_draw_depth() == FBMODE_BPP4)
+		printf("no plot port at 4bpp, CPU only\n");
+	for (int port = 0; port < 2; port++) {
+		if (plot_port_enable(port) != port)
+			break;
+		blocks = *PLOT_PORT;
+		start_msec = systime_msec();
+		for (int i = 0; i < npoints; i++) {
+			seed ^= seed << 13, seed ^= seed >> 17, seed ^= seed << 5;
+			plot_point((seed & 0xffff) % fb_width(), (seed >> 16) % fb_height(), argb);
+		}
+		plot_sync();
+		msecs = systime_msec() - start_msec;
+		printf("%s points: %ld msecs, %ld points/s", port ? "port" : "cpu ", msecs,
+			   msecs ? npoints * 1000 / msecs : 0);
+		if (port)
+			printf(", %ld blocks", *PLOT_PORT - blocks);
+		printf("\n");
+
+		blocks = *PLOT_PORT;
+		pixels = 0;
+		start_msec = systime_msec();
+		for (int i = 0; i < nlines; i++) {
+			int x0, y0, x1, y1;
+			seed ^= seed << 13, seed ^= seed >> 17, seed ^= seed << 5;
+			x0 = (seed & 0xffff) % fb_width(), y0 = (seed >> 16) % fb_height();
+			seed ^= seed << 13, seed ^= seed >> 17, seed ^= seed << 5;
+			x1 = (seed & 0xffff) % fb_width(), y1 = (seed >> 16) % fb_height();
+			plot_line(x0, y0, x1, y1, argb);
+			pixels += MAX(abs(x1 - x0), abs(y1 - y0)) + 1;
+		}
+		plot_sync();
+		msecs = systime_msec() - start_msec;
+		printf("%s lines:  %ld msecs, %ld pixels/s", port ? "port" : "cpu ", msecs,
+			   msecs ? pixels / msecs * 1000 : 0);
+		blocks = *PLOT_PORT - blocks;
+		if (port && blocks)
+			printf(", %ld.%02ld pixels/block", pixels / blocks, pixels * 100 / blocks % 100);
+		printf("\n");
+	}
+	plot_port_enable(was_on);
+	return 0;
+}
+
 int cmd_drawpoint(int argc, char *argv[])
 {
 	int		 x, y;
@@ -581,21 +743,26 @@ int cmd_drawpoint(int argc, char *argv[])
 
 	if (anyopts(argc, argv, "-h") > 0)
 		goto usage;
+	if (anyopts(argc, argv, "-t") > 0)
+		return plot_port_test();
 	if (anyopts(argc, argv, "-s") > 0)
 		use_sw = true;
 	if (argc < (3 + (use_sw ? 1 : 0)))
 		goto usage;
 
 	x = strtol(argv[argc - 2], NULL, 0);
-	if (x < 0 || x >= LCD_WIDTH)
+	if (x < 0 || x >= fb_width())
 		goto usage;
 	y = strtol(argv[argc - 1], NULL, 0);
-	if (y < 0 || y >= LCD_HEIGHT)
+	if (y < 0 || y >= fb_height())
 		goto usage;
 	printf("drawing point (%d, %d) with 0x%08X\n", x, y, color);
 
 	if (use_sw) {
+		bool port = plot_port_enabled();
+		plot_port_enable(false);
 		plot_point(x, y, color);
+		plot_port_enable(port);
 	}
 	else {
 		lcd_regs->argb = color;
@@ -611,8 +778,10 @@ int cmd_drawpoint(int argc, char *argv[])
 usage:
 	// printf("Usage: %s [-s] <x> <y> [rgb (24-bit in hex)]\n"
 	printf("Usage: %s [-s] <x> <y>\n"
-		   "    -s use software drawpoint\n",
-		   argv[0]);
+		   "       %s -t\n"
+		   "    -s use software drawpoint\n"
+		   "    -t compare CPU stores and plot port on random points and lines\n",
+		   argv[0], argv[0]);
 	return -1;
 }
 
@@ -624,13 +793,13 @@ int cmd_drawcircle(int argc, char *argv[])
 	if (argc < 4)
 		goto usage;
 	x0 = strtol(argv[1], NULL, 0);
-	if (x0 < 0 || x0 >= LCD_WIDTH)
+	if (x0 < 0 || x0 >= fb_width())
 		goto usage;
 	y0 = strtol(argv[2], NULL, 0);
-	if (y0 < 0 || y0 >= LCD_HEIGHT)
+	if (y0 < 0 || y0 >= fb_height())
 		goto usage;
 	rad = strtol(argv[3], NULL, 0);
-	if (rad < 0 || rad >= LCD_WIDTH)
+	if (rad < 0 || rad >= fb_width())
 		goto usage;
 	if (argc > 4)
 		color = strtol(argv[4], NULL, 16);
@@ -701,13 +870,48 @@ int cmd_gcu_reg(int argc, char *argv[])
 		printf("reg 4: X0Y0_reg (0x10): 0x%08X\n", *GPU_X0Y0);
 		printf("reg 5: X1Y1_reg (0x14): 0x%08X\n", *GPU_X1Y1);
 		printf("reg 6: size_reg (0x18): 0x%08X\n", *GPU_SIZE);
+		printf("reg 7: caps     (0x1C): 0x%08X\n", *GPU_CAPS);
+		printf("reg 8: srcaddr  (0x20): 0x%08X\n", *GPU_SRCADDR);
+		printf("reg 9: srcxy    (0x24): 0x%08X\n", *GPU_SRCXY);
+		printf("reg 10: txtctrl (0x28): 0x%08X\n", *TXT_CTRL);
+		printf("reg 11: txtcurs (0x2C): 0x%08X\n", *TXT_CURSOR);
+		printf("reg 12: txtscrl (0x30): 0x%08X\n", *TXT_SCROLL);
+		printf("reg 13: txtpal  (0x34): 0x%08X\n", *TXT_PALETTE);
+		printf("reg 14: spren   (0x38): 0x%08X\n", *SPR_ENABLE);
+		printf("reg 15: sprkey  (0x3C): 0x%08X\n", *SPR_KEY);
+		for (int n = 0; n < SPR_COUNT; n++)
+			printf("reg %d: sprpos%d (0x%02X): 0x%08X\n", 16 + n, n, (16 + n) * 4, *SPR_POS(n));
+		printf("reg 20: ovladdr (0x50): 0x%08X\n", *OVL_ADDR);
+		printf("reg 21: ovlctrl (0x54): 0x%08X\n", *OVL_CTRL);
+		printf("reg 22: ovlx0y0 (0x58): 0x%08X\n", *OVL_X0Y0);
+		printf("reg 23: ovlx1y1 (0x5C): 0x%08X\n", *OVL_X1Y1);
+		printf("reg 24: fbmode  (0x60): 0x%08X\n", *FB_MODE);
+		printf("reg 25: palette (0x64): 0x%08X\n", *FB_PALETTE);
+		printf("reg 26: fbsize  (0x68): 0x%08X\n", *FB_SIZE);
+		printf("reg 27: arbctrl (0x6C): 0x%08X\n", *ARB_CTRL);
+		printf("reg 28: arbcpu  (0x70): 0x%08X\n", *ARB_CPU);
+		printf("reg 29: arbvdma (0x74): 0x%08X\n", *ARB_VDMA);
+		printf("reg 30: vdmastat(0x78): 0x%08X\n", *VDMA_STAT);
+		printf("reg 31: frames  (0x7C): 0x%08X\n", *VDMA_FRAMES);
+		printf("reg 32: plot    (0x80): 0x%08X\n", *PLOT_PORT);
+		printf("reg 33: clipx0y0(0x84): 0x%08X\n", *GPU_CLIPX0Y0);
+		printf("reg 34: clipx1y1(0x88): 0x%08X\n", *GPU_CLIPX1Y1);
+		printf("reg 35: stride  (0x8C): 0x%08X\n", *GPU_STRIDE);
+		for (int n = 0; n < 9; n++)
+			printf("reg %d: trap%d   (0x%02X): 0x%08X\n", 36 + n, n, (36 + n) * 4, *GPU_TRAP(n));
+		for (int n = 0; n < 7; n++)
+			printf("reg %d: grad%d   (0x%02X): 0x%08X\n", 45 + n, n, (45 + n) * 4, *GPU_GRAD(n));
+		for (int n = 0; n < 7; n++)
+			printf("reg %d: xform%d  (0x%02X): 0x%08X\n", 52 + n, n, (52 + n) * 4, *GPU_XFORM(n));
+		printf("reg 59: spanaddr(0xEC): 0x%08X\n", *GPU_SPANADDR);
+		printf("reg 60: spanctrl(0xF0): 0x%08X\n", *GPU_SPANCTRL);
 		return 0;
 	}
 	if (argc == 3) {
 		if (isxdigit(*argv[1])) {
 			addr = strtoul(argv[1], NULL, 0);
 			val = strtoul(argv[2], NULL, 0);
-			if (addr > 6)
+			if (addr >= sizeof(LCD_REGS_T) / sizeof(uint32_t))
 				goto usage;
 			addr *= sizeof(uint32_t);
 			addr += LCD_REGADDR;
@@ -755,64 +959,82 @@ int cmd_msectest(int argc, char *argv[])
 
 int cmd_gprinttext(int argc, char *argv[])
 {
-	int x, y;
+	int		 x, y, fontnum = -1;
+	int		 argi = 1;
+	uint32_t fg = lcd_regs->argb;
 
-	if (argc != 4)
-		goto usage;
 	if (anyopts(argc, argv, "-h") > 0)
 		goto usage;
+	if (argc > 2 && strcmp(argv[1], "-f") == 0) {
+		fontnum = strtol(argv[2], NULL, 0);
+		if (fontnum < 0 || fontnum >= fb_font_count())
+			goto usage;
+		argi = 3;
+	}
+	if (argc != argi + 3)
+		goto usage;
 
-	x = strtol(argv[1], NULL, 0);
-	if (x < 0 || x >= LCD_WIDTH)
+	x = strtol(argv[argi], NULL, 0);
+	if (x < 0 || x >= fb_width())
 		goto usage;
-	y = strtol(argv[2], NULL, 0);
-	if (y < 0 || y >= LCD_HEIGHT)
+	y = strtol(argv[argi + 1], NULL, 0);
+	if (y < 0 || y >= fb_height())
 		goto usage;
-	printf("drawing text \"%s\" at (%d, %d)\n", argv[3], x, y);
+	printf("drawing text \"%s\" at (%d, %d)\n", argv[argi + 2], x, y);
 
-	for (char *p = argv[3]; *p; p++) {
-		x = plot_char(x, y, 1, *p);
+	for (char *p = argv[argi + 2]; *p; p++) {
+		if (fontnum < 0)
+			x = plot_char(x, y, 1, *p);
+		else
+			x = plot_glyph(x, y, fontnum, *p, fg, 0x000000);
 	}
 	return 0;
 
 usage:
 	printf("%s - Prints text at coordinates\n", argv[0]);
-	printf("Usage: %s <x> <y> \"any text\"\n", argv[0]);
+	printf("Usage: %s [-f fontnum] <x> <y> \"any text\"\n"
+		   "    -f draw with blit-ready font 0..%d (fg color on black)\n",
+		   argv[0], fb_font_count() - 1);
 	return -1;
 }
 
 int cmd_drawrect(int argc, char *argv[])
 {
 	int		 x0, y0, x1, y1;
+	int		 opcode = GPU_FRECT, argi = 1;
 	uint32_t argb32 = lcd_regs->argb;
 	uint32_t start_msec, end_msec;
-	int		 waitcount = 0;
-
-	if (argc < 5)
-		goto usage;
-	x0 = strtol(argv[1], NULL, 0);
-	if (x0 < 0 || x0 >= LCD_WIDTH)
-		goto usage;
-	y0 = strtol(argv[2], NULL, 0);
-	if (y0 < 0 || y0 >= LCD_HEIGHT)
-		goto usage;
-	x1 = strtol(argv[3], NULL, 0);
-	if (x1 < 0 || x1 >= LCD_WIDTH)
+	int		 waitcount;
+
+	if (argc > 2 && strcmp(argv[1], "-a") == 0) {
+		/* translucent, the color with this alpha */
+		if (!(*GPU_CAPS & GPU_CAP_BLEND))
+			goto usage;
+		argb32 = ARGB_ALPHA(argb32, strtol(argv[2], NULL, 0));
+		opcode = GPU_FRECT_BLEND;
+		argi = 3;
+	}
+	if (argc < argi + 4)
 		goto usage;
-	y1 = strtol(argv[4], NULL, 0);
-	if (y1 < 0 || y1 >= LCD_HEIGHT)
+	x0 = strtol(argv[argi], NULL, 0);
+	y0 = strtol(argv[argi + 1], NULL, 0);
+	x1 = strtol(argv[argi + 2], NULL, 0);
+	y1 = strtol(argv[argi + 3], NULL, 0);
+	/* the GPU clips to the scissor, older bitstreams only take the screen */
+	if (!(*GPU_CAPS & GPU_CAP_CLIP) &&
+		(x0 < 0 || x1 >= fb_width() || y0 < 0 || y1 >= fb_height()))
 		goto usage;
 
 	const char *color_str = colorname(argb32);
 
+	uint32_t tmp_color = lcd_regs->argb;
 	start_msec = systime_msec();
+	lcd_regs->argb = argb32;
 	lcd_regs->x0y0 = (x0 & 0xffff) | ((y0 & 0xffff) << 16);
 	lcd_regs->x1y1 = (x1 & 0xffff) | ((y1 & 0xffff) << 16);
-	lcd_regs->ctrlstat = 0;
-	lcd_regs->ctrlstat = GPU_FRECT << 1 | 1;
-	while (waitcount++ < 10000 & (*GPU_CTRLSTAT & CTRLSTAT_BUSY))
-		;
-	lcd_regs->ctrlstat = 0;
+	/* the GPU reads argb while it fills, restored only once it is done */
+	waitcount = gpu_exec(opcode);
+	lcd_regs->argb = tmp_color;
 
 	end_msec = systime_msec();
 	printf("drawn filled rect from (%d, %d) to (%d, %d) with #%08X %s in "
@@ -823,6 +1045,1576 @@ int cmd_drawrect(int argc, char *argv[])
 	return 0;
 
 usage:
-	printf("Usage: %s <x0> <y0> <x1> <y1>\n", argv[0]);
+	printf("Usage: %s [-a alpha] <x0> <y0> <x1> <y1>\n", argv[0]);
+	return -1;
+}
+
+int cmd_glyphcache(int argc, char *argv[])
+{
+	int			 fontnum = 1, loops = 20;
+	int			 x, y, n, line_h;
+	uint32_t	 fg = lcd_regs->argb;
+	uint32_t	 start_msec, msecs[2];
+	uint32_t	 start_cyc, end_cyc;
+	const char	*text = "The quick brown fox jumps over the lazy dog 0123456789";
+	const char	*p;
+	GCACHE_STATS before;
+
+	if (anyopts(argc, argv, "-h") > 0 || argc < 2)
+		goto usage;
+	if (anyopts(argc, argv, "-f") > 0) {
+		gcache_flush();
+		printf("glyph cache flushed\n");
+	}
+	if (anyopts(argc, argv, "-w") > 0) {
+		gcache_use_gpu(false);
+		printf("glyph cache copies with CPU word stores\n");
+	}
+	if (anyopts(argc, argv, "-g") > 0) {
+		gcache_use_gpu(true);
+		printf("glyph cache copies with GPU blit%s\n",
+			   (*GPU_CAPS & GPU_CAP_BLIT) ? "" : " (not in this bitstream, using CPU)");
+	}
+	if (anyopts(argc, argv, "-b") > 0) {
+		if (*argv[argc - 1] != '-')
+			loops = strtol(argv[argc - 1], NULL, 0);
+		if (loops <= 0)
+			goto usage;
+		line_h = fbfont_hdr(fb_font(fontnum))->height;
+		n = 0;
+		for (int pass = 0; pass < 2; pass++) {
+			before = gcache_stats;
+			start_msec = systime_msec();
+			__asm__ volatile("rdcycle %0"
+							 : "=r"(start_cyc));
+			n = 0;
+			for (int i = 0; i < loops; i++) {
+				x = 0;
+				y = (i * line_h) % (LCD_HEIGHT - line_h);
+				for (p = text; *p; p++, n++) {
+					if (pass == 0)
+						x = plot_glyph(x, y, fontnum, *p, fg, 0x000000);
+					else
+						x = gcache_putc(LCD_FBADDR, x, y, fontnum, *p, fg, 0x000000);
+				}
+			}
+			__asm__ volatile("rdcycle %0"
+							 : "=r"(end_cyc));
+			msecs[pass] = systime_msec() - start_msec;
+			if (msecs[pass] == 0)
+				msecs[pass] = 1;
+			printf("%-8s %6d chars %6ld msecs %7ld chars/s %6ld cycles/char",
+				   pass == 0 ? "direct" : "cached", n, msecs[pass],
+				   n * 1000 / msecs[pass], (end_cyc - start_cyc) / n);
+			if (pass == 1)
+				printf(" (%ld hits, %ld misses)",
+					   gcache_stats.hits - before.hits,
+					   gcache_stats.misses - before.misses);
+			printf("\n");
+		}
+		printf("speedup x%ld.%02ld\n", msecs[0] / msecs[1],
+			   (msecs[0] * 100 / msecs[1]) % 100);
+	}
+	if (anyopts(argc, argv, "-s") > 0) {
+		printf("hits %ld, misses %ld, evictions %ld, bypassed %ld\n"
+			   "gpu blits %ld, cpu copies %ld\n",
+			   gcache_stats.hits, gcache_stats.misses, gcache_stats.evictions,
+			   gcache_stats.bypassed, gcache_stats.gpu_blits, gcache_stats.cpu_copies);
+		if (gcache_stats.hits + gcache_stats.misses)
+			printf("hit rate %ld%%\n", gcache_stats.hits * 100 /
+											  (gcache_stats.hits + gcache_stats.misses));
+	}
+	return 0;
+
+usage:
+	printf("%s - rendered glyph cache (%d slots in PSRAM at 0x%08X)\n",
+		   argv[0], GCACHE_SLOTS, GCACHE_ATLAS_ADDR);
+	printf("Usage: %s [-h] [-s] [-f] [-g|-w] [-b [lines]]\n"
+		   "    -s show hit/miss statistics\n"
+		   "    -f flush the cache\n"
+		   "    -g copy cached glyphs with the GPU blit (default)\n"
+		   "    -w copy cached glyphs with CPU word stores\n"
+		   "    -b benchmark direct vs cached text drawing\n",
+		   argv[0]);
+	return -1;
+}
+
+int cmd_console(int argc, char *argv[])
+{
+	int		 cols, rows;
+	uint32_t viewaddr;
+
+	if (anyopts(argc, argv, "-h") > 0 || argc < 2)
+		goto usage;
+	if (anyopts(argc, argv, "-f") > 0) {
+		int fontnum = strtol(argv[argc - 1], NULL, 0);
+		if (fontnum < 0 || fontnum >= fb_font_count())
+			goto usage;
+		fbcon_init(fontnum);
+	}
+	if (anyopts(argc, argv, "-t") > 0) {
+		if (fbcon_init(FBCON_HWTEXT) < 0)
+			printf("no text layer in this bitstream\n");
+	}
+	if (anyopts(argc, argv, "-c") > 0)
+		fbcon_show(true);
+	if (anyopts(argc, argv, "-g") > 0)
+		fbcon_show(false);
+	if (anyopts(argc, argv, "-b") > 0) {
+		int lines = strtol(argv[argc - 1], NULL, 0);
+		printf("showing %d lines back%s\n", fbcon_scrollback(lines),
+			   lines ? ", \"con -b 0\" returns to live" : "");
+	}
+	if (anyopts(argc, argv, "-s") > 0) {
+		fbcon_geometry(&cols, &rows, &viewaddr);
+		printf("%dx%d cells, view at 0x%08lX, %s on LCD\n", cols, rows, viewaddr,
+			   fbcon_shown() ? "shown" : "not");
+		printf("chars %ld, scrolls %ld, wraps %ld, rows drawn %ld, cells drawn %ld, "
+			   "flush %ld msecs\n",
+			   fbcon_stats.chars, fbcon_stats.scrolls, fbcon_stats.wraps,
+			   fbcon_stats.rows_drawn, fbcon_stats.cells_drawn, fbcon_stats.flush_msecs);
+	}
+	return 0;
+
+usage:
+	printf("%s - framebuffer text console (stdout mirror)\n", argv[0]);
+	printf("Usage: %s [-h] [-s] [-c|-g] [-b lines] [-t|-f fontnum]\n"
+		   "    -s show console statistics\n"
+		   "    -c show the console on the LCD\n"
+		   "    -g show the graphics framebuffer on the LCD\n"
+		   "    -b view the scrollback, lines back (0 is live)\n"
+		   "    -t restart the console on the hardware text layer\n"
+		   "    -f restart the console with blit-ready font 0..%d\n",
+		   argv[0], fb_font_count() - 1);
+	return -1;
+}
+
+int cmd_sprite(int argc, char *argv[])
+{
+	int n, x, y;
+
+	if (anyopts(argc, argv, "-h") > 0 || argc < 2)
+		goto usage;
+	if (!sprite_available()) {
+		printf("no sprites in this bitstream\n");
+		return -1;
+	}
+
+	if (strcmp(argv[1], "-a") == 0 && argc == 3) {
+		n = strtol(argv[2], NULL, 0);
+		if (n < 0 || n >= SPR_COUNT)
+			goto usage;
+		sprite_make_arrow(n, 0xFFFF, 0x0000);
+	}
+	else if (strcmp(argv[1], "-g") == 0 && argc == 5) {
+		n = strtol(argv[2], NULL, 0);
+		x = strtol(argv[3], NULL, 0);
+		y = strtol(argv[4], NULL, 0);
+		if (n < 0 || n >= SPR_COUNT || x < 0 || x > LCD_WIDTH - SPR_W ||
+			y < 0 || y > LCD_HEIGHT - SPR_H)
+			goto usage;
+		sprite_grab(n, lcd_regs->workaddr, x, y);
+	}
+	else if ((strcmp(argv[1], "-e") == 0 || strcmp(argv[1], "-d") == 0) && argc == 3) {
+		n = strtol(argv[2], NULL, 0);
+		if (n < 0 || n >= SPR_COUNT)
+			goto usage;
+		sprite_show(n, argv[1][1] == 'e');
+	}
+	else if (strcmp(argv[1], "-k") == 0 && argc == 3) {
+		uint32_t argb32;
+		if (str2argb32(argv[2], &argb32) != 0)
+			goto usage;
+		sprite_set_key(argb2rgb565(argb32));
+	}
+	else if (strcmp(argv[1], "-m") == 0) {
+		/* bounce sprite 0 for a few seconds, each move is one register write */
+		uint32_t start_msec = systime_msec();
+		uint32_t moves = 0;
+		int		 dx = 3, dy = 2;
+		x = y = 0;
+		sprite_show(0, true);
+		while (systime_msec() - start_msec < 5000) {
+			uint32_t t = systime_msec();
+			while (systime_msec() - t < 16)
+				;
+			x += dx;
+			y += dy;
+			if (x < 0 || x > LCD_WIDTH - SPR_W)
+				dx = -dx;
+			if (y < 0 || y > LCD_HEIGHT - SPR_H)
+				dy = -dy;
+			sprite_move(0, x, y);
+			moves++;
+		}
+		printf("%ld moves in 5 s, no framebuffer writes\n", moves);
+	}
+	else if (argc == 4 && isdigit(*argv[1])) {
+		n = strtol(argv[1], NULL, 0);
+		if (n < 0 || n >= SPR_COUNT)
+			goto usage;
+		sprite_move(n, strtol(argv[2], NULL, 0), strtol(argv[3], NULL, 0));
+	}
+	else
+		goto usage;
+	return 0;
+
+usage:
+	printf("%s - hardware sprites 0..%d (%dx%d RGB565, key color transparent)\n",
+		   argv[0], SPR_COUNT - 1, SPR_W, SPR_H);
+	printf("Usage: %s <n> <x> <y>        move sprite n\n"
+		   "       %s -e|-d <n>          enable/disable sprite n\n"
+		   "       %s -a <n>             load the arrow pointer into sprite n\n"
+		   "       %s -g <n> <x> <y>     grab 32x32 pixels at x,y of the work surface\n"
+		   "       %s -k <color>         set the transparent key color\n"
+		   "       %s -m                 bounce sprite 0 for 5 seconds\n",
+		   argv[0], argv[0], argv[0], argv[0], argv[0], argv[0]);
+	return -1;
+}
+
+int cmd_overlay(int argc, char *argv[])
+{
+	static uint32_t surface, panel; /* set with -s, the heap block -t draws into */
+	uint32_t		argb32;
+	uint32_t		ctrl;
+	int				x, y, w, h;
+
+	if (anyopts(argc, argv, "-h") > 0)
+		goto usage;
+	if (!overlay_available()) {
+		printf("no overlay layer in this bitstream\n");
+		return -1;
+	}
+
+	ctrl = lcd_regs->ovlctrl;
+	if (argc < 2) {
+		x = lcd_regs->ovlx0y0 & 0x7ff;
+		y = (lcd_regs->ovlx0y0 >> 16) & 0x3ff;
+		printf("overlay %s, surface 0x%08lX at %d,%d size %ldx%ld, alpha %ld, key %s 0x%04lX\n",
+			   (ctrl & OVLCTRL_ENABLE) ? "on" : "off", lcd_regs->ovladdr, x, y,
+			   (lcd_regs->ovlx1y1 & 0x7ff) - x + 1, ((lcd_regs->ovlx1y1 >> 16) & 0x3ff) - y + 1,
+			   (ctrl >> 8) & 0xff, (ctrl & OVLCTRL_KEY) ? "on" : "off", ctrl >> 16);
+		return 0;
+	}
+
+	if (strcmp(argv[1], "-s") == 0 && argc == 3) {
+		surface = strtoul(argv[2], NULL, 0);
+		lcd_regs->ovladdr = surface;
+	}
+	else if (strcmp(argv[1], "-w") == 0 && argc == 6) {
+		if (!surface) {
+			printf("no overlay surface, set one with -s\n");
+			return -1;
+		}
+		x = strtol(argv[2], NULL, 0);
+		y = strtol(argv[3], NULL, 0);
+		w = strtol(argv[4], NULL, 0);
+		h = strtol(argv[5], NULL, 0);
+		if (overlay_set_window(surface, x, y, w, h) < 0)
+			goto usage;
+	}
+	else if (strcmp(argv[1], "-a") == 0 && argc == 3) {
+		overlay_set_mode(strtol(argv[2], NULL, 0), ctrl & OVLCTRL_KEY, ctrl >> 16);
+	}
+	else if (strcmp(argv[1], "-k") == 0 && argc == 3) {
+		if (strcmp(argv[2], "off") == 0)
+			overlay_set_mode((ctrl >> 8) & 0xff, false, ctrl >> 16);
+		else if (str2argb32(argv[2], &argb32) == 0)
+			overlay_set_mode((ctrl >> 8) & 0xff, true, argb2rgb565(argb32));
+		else
+			goto usage;
+	}
+	else if (strcmp(argv[1], "-e") == 0 || strcmp(argv[1], "-d") == 0) {
+		overlay_show(argv[1][1] == 'e');
+	}
+	else if (strcmp(argv[1], "-t") == 0) {
+		/* draw a panel into the overlay surface only and slide it across
+		 * the screen, the base framebuffer is never written */
+		uint32_t start_msec, frames = 0;
+		int		 dx = 4;
+
+		w = 480;
+		h = 160;
+		x = 0;
+		y = (LCD_HEIGHT - h) / 2;
+		/* without -s, a heap block kept for later runs, never the back buffer */
+		if (!surface) {
+			if (!panel)
+				panel = surface_heap_alloc(h * LCD_WIDTH * LCD_PIXELBYTES + 0x800);
+			if (!panel) {
+				printf("out of surface memory\n");
+				return -1;
+			}
+			surface = (panel + 0x7ff) & ~0x7ff;
+		}
+		gpu_fill_rect(surface, 0, 0, w, h, 0xFFFF00FF);
+		gpu_fill_rect(surface, 8, 8, w - 16, h - 16, 0xFF202060);
+		gpu_fill_rect(surface, 24, 60, w - 48, 40, 0xFFFF00FF);
+		gcache_puts(surface, 24, 24, 0, "overlay layer, magenta is keyed out", 0xFFFFFFFF, 0xFF202060);
+		overlay_set_window(surface, x, y, w, h);
+		overlay_set_mode(192, true, OVL_KEY_DEFAULT);
+		overlay_show(true);
+		start_msec = systime_msec();
+		while (systime_msec() - start_msec < 5000) {
+			uint32_t t = systime_msec();
+			while (systime_msec() - t < 16)
+				;
+			x += dx;
+			if (x < 0 || x > LCD_WIDTH - w) {
+				dx = -dx;
+				x += 2 * dx;
+			}
+			overlay_set_window(surface, x, y, w, h);
+			frames++;
+		}
+		printf("%ld window moves in 5 s, no base framebuffer writes\n", frames);
+	}
+	else
+		goto usage;
+	return 0;
+
+usage:
+	printf("%s - overlay layer composited over the framebuffer\n", argv[0]);
+	printf("Usage: %s                    show overlay state\n"
+		   "       %s -e|-d              enable/disable the overlay\n"
+		   "       %s -s <addr>          overlay surface (2048-byte aligned)\n"
+		   "       %s -w <x> <y> <w> <h> window on screen\n"
+		   "       %s -a <alpha>         global alpha 0..255 (255 opaque)\n"
+		   "       %s -k <color>|off     transparent key color\n"
+		   "       %s -t                 draw a test panel into the surface (a new\n"
+		   "                             one without -s) and slide it\n",
+		   argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0]);
+	return -1;
+}
+
+static const int depth_bpp[] = { 16, 8, 4 };
+
+static int bpp2depth(const char *str)
+{
+	int bpp = strtol(str, NULL, 0);
+	for (int d = 0; d < 3; d++)
+		if (depth_bpp[d] == bpp)
+			return d;
+	return -1;
+}
+
+int cmd_fbmode(int argc, char *argv[])
+{
+	uint32_t mode = lcd_regs->fbmode;
+	int		 scan, draw;
+
+	if (anyopts(argc, argv, "-h") > 0)
+		goto usage;
+	if (argc < 2) {
+		printf("%dx%d, scanout %d bpp, draw %d bpp\n", fb_width(), fb_height(),
+			   depth_bpp[mode & 3], depth_bpp[(mode >> 8) & 3]);
+		return 0;
+	}
+
+	if (strcmp(argv[1], "-p") == 0) {
+		fb_default_palette(mode & 3);
+	}
+	else if (strcmp(argv[1], "-s") == 0 && argc == 3) {
+		int factor = strtol(argv[2], NULL, 0);
+		if (factor != 1 && factor != 2 && factor != 4)
+			goto usage;
+		if (fb_set_scale(factor == 4 ? 2 : factor / 2) < 0) {
+			printf("no scaled modes in this bitstream\n");
+			return -1;
+		}
+		printf("%dx%d\n", fb_width(), fb_height());
+	}
+	else if (strcmp(argv[1], "-t") == 0) {
+		uint32_t tmp_color = lcd_regs->argb;
+		uint32_t start_msec, n;
+
+		if (!(*GPU_CAPS & GPU_CAP_INDEXED)) {
+			printf("no indexed modes in this bitstream\n");
+			return -1;
+		}
+		/* same clear at each depth, the fill moves 2, 1 and 1/2 bytes per pixel */
+		for (int d = FBMODE_BPP16; d <= FBMODE_BPP4; d++) {
+			fb_set_mode(FBMODE_BPP8, d);
+			lcd_regs->argb = 0;
+			start_msec = systime_msec();
+			gpu_exec(GPU_SETBG);
+			printf("clear at %2d bpp: %ld msecs\n", depth_bpp[d], systime_msec() - start_msec);
+		}
+		for (int scale = 1; scale <= 2 && fb_set_scale(scale) == 0; scale++) {
+			fb_set_mode(FBMODE_BPP16, FBMODE_BPP16);
+			start_msec = systime_msec();
+			gpu_exec(GPU_SETBG);
+			printf("clear at %dx%d 16 bpp: %ld msecs\n", fb_width(), fb_height(),
+				   systime_msec() - start_msec);
+		}
+		fb_set_scale(0);
+		/* 16x16 index swatches, then rotate the palette: no pixel is redrawn */
+		fb_set_mode(FBMODE_BPP8, FBMODE_BPP8);
+		fb_default_palette(FBMODE_BPP8);
+		for (int i = 0; i < 256; i++) {
+			lcd_regs->argb = i;
+			lcd_regs->x0y0 = ((i % 16) * 64) | (((i / 16) * 37) << 16);
+			lcd_regs->x1y1 = ((i % 16) * 64 + 63) | (((i / 16) * 37 + 36) << 16);
+			gpu_exec(GPU_FRECT);
+		}
+		start_msec = systime_msec();
+		for (n = 0; systime_msec() - start_msec < 5000; n++) {
+			for (int i = 0; i < 256; i++) {
+				uint32_t c = (i + n) & 0xff;
+				fb_set_palette(i, ((c >> 5) * 255 / 7) << 16 | (((c >> 2) & 7) * 255 / 7) << 8 |
+									  (c & 3) * 255 / 3);
+			}
+		}
+		printf("%ld palette rotations in 5 s, \"%s 16\" returns to RGB565\n", n, argv[0]);
+		lcd_regs->argb = tmp_color;
+	}
+	else {
+		scan = bpp2depth(argv[1]);
+		draw = (argc > 2) ? bpp2depth(argv[2]) : scan;
+		if (scan < 0 || draw < 0)
+			goto usage;
+		if (fb_set_mode(scan, draw) < 0) {
+			printf("no indexed modes in this bitstream\n");
+			return -1;
+		}
+		if (scan != (mode & 3) && scan != FBMODE_BPP16)
+			fb_default_palette(scan);
+	}
+	return 0;
+
+usage:
+	printf("%s - framebuffer pixel depth, indexed modes use a 256 entry palette\n", argv[0]);
+	printf("Usage: %s [16|8|4] [draw 16|8|4]  set scanout and GPU draw depth\n"
+		   "       %s -s <1|2|4>             pixel doubling, 1024x600, 512x300, 256x150\n"
+		   "       %s -p                     load the default palette\n"
+		   "       %s -t                     fill timing and palette animation test\n",
+		   argv[0], argv[0], argv[0], argv[0]);
+	return -1;
+}
+
+static void arb_show(void)
+{
+	uint32_t ctrl = lcd_regs->arbctrl;
+	uint32_t cpu = lcd_regs->arbcpu;
+
+	printf("max CPU wait %ld cycles%s, video slack %ld px\n", ARBCTRL_MAXWAIT(ctrl),
+		   ARBCTRL_MAXWAIT(ctrl) ? "" : " (unbounded)", (ctrl & ARBCTRL_SLACK_MASK) >> 16);
+	printf("longest CPU wait %ld cycles, %ld forced CPU grants, %ld urgent video blocks\n",
+		   ARBCPU_WAITMAX(cpu), ARBCPU_FORCED(cpu), lcd_regs->arbvdma);
+	if (*GPU_CAPS & GPU_CAP_VSTAT) {
+		uint32_t vstat = lcd_regs->vdmastat;
+		printf("frame %ld: %ld late lines, %ld underrun blocks\n", lcd_regs->frames,
+			   VSTAT_LATE(vstat), VSTAT_UNDERRUN(vstat));
+	}
+}
+
+int cmd_arbiter(int argc, char *argv[])
+{
+	uint32_t ctrl;
+
+	if (anyopts(argc, argv, "-h") > 0)
+		goto usage;
+	if (!(*GPU_CAPS & GPU_CAP_ARB)) {
+		printf("no arbiter counters in this bitstream\n");
+		return -1;
+	}
+	ctrl = lcd_regs->arbctrl;
+	if (argc < 2) {
+		arb_show();
+	}
+	else if (strcmp(argv[1], "-w") == 0 && argc == 3) {
+		lcd_regs->arbctrl = (ctrl & ~ARBCTRL_MAXWAIT_MASK) |
+							ARBCTRL_MAXWAIT(strtoul(argv[2], NULL, 0));
+	}
+	else if (strcmp(argv[1], "-s") == 0 && argc == 3) {
+		lcd_regs->arbctrl = (ctrl & ~ARBCTRL_SLACK_MASK) |
+							ARBCTRL_SLACK(strtoul(argv[2], NULL, 0));
+	}
+	else if (strcmp(argv[1], "-c") == 0) {
+		lcd_regs->arbcpu = 0;
+	}
+	else if (strcmp(argv[1], "-t") == 0) {
+		/* CPU reads against back-to-back GPU fills of the back buffer, while
+		 * scanning out: the longest wait has to stay within the max wait
+		 * plus the one access running when it expires */
+		uint32_t tmp_workaddr = lcd_regs->workaddr;
+		uint32_t tmp_mode = lcd_regs->fbmode;
+		uint32_t start_msec, fills = 0, reads = 0;
+		volatile uint32_t *p = (uint32_t *)LCD_SPAREEND - 1;
+
+		lcd_regs->fbmode = tmp_mode & ~FBMODE_DRAW_MASK;
+		lcd_regs->workaddr = LCD_FBADDR2;
+		lcd_regs->x0y0 = 0;
+		lcd_regs->x1y1 = (LCD_WIDTH - 1) | ((LCD_HEIGHT - 1) << 16);
+		lcd_regs->arbcpu = 0;
+		start_msec = systime_msec();
+		while (systime_msec() - start_msec < 2000) {
+			lcd_regs->ctrlstat = 0;
+			lcd_regs->ctrlstat = GPU_FRECT << 1 | 1;
+			while (*GPU_CTRLSTAT & CTRLSTAT_BUSY) {
+				(void)*p;
+				reads++;
+			}
+			fills++;
+		}
+		lcd_regs->ctrlstat = 0;
+		lcd_regs->workaddr = tmp_workaddr;
+		lcd_regs->fbmode = tmp_mode;
+		printf("%ld fills, %ld CPU reads in 2 s\n", fills, reads);
+		arb_show();
+	}
+	else
+		goto usage;
+	return 0;
+
+usage:
+	printf("%s - PSRAM arbiter between scanout, CPU and GPU\n", argv[0]);
+	printf("Usage: %s               show settings and counters\n"
+		   "       %s -w <cycles>   max CPU wait in mclk cycles, 0 unbounded\n"
+		   "       %s -s <pixels>   how far video fetches may lag the beam\n"
+		   "       %s -c            clear the counters\n"
+		   "       %s -t            CPU reads during GPU fills, check the bound\n",
+		   argv[0], argv[0], argv[0], argv[0], argv[0]);
+	return -1;
+}
+
+int cmd_clip(int argc, char *argv[])
+{
+	int x0, y0, x1, y1;
+
+	if (anyopts(argc, argv, "-h") > 0)
+		goto usage;
+	if (!(*GPU_CAPS & GPU_CAP_CLIP)) {
+		printf("no scissor in this bitstream\n");
+		return -1;
+	}
+	if (argc == 2 && strcmp(argv[1], "-r") == 0) {
+		fb_set_clip(0, 0, fb_width() - 1, fb_height() - 1);
+	}
+	else if (argc == 5) {
+		x0 = strtol(argv[1], NULL, 0);
+		y0 = strtol(argv[2], NULL, 0);
+		x1 = strtol(argv[3], NULL, 0);
+		y1 = strtol(argv[4], NULL, 0);
+		fb_set_clip(x0, y0, x1, y1);
+	}
+	else if (argc != 1)
+		goto usage;
+	fb_get_clip(&x0, &y0, &x1, &y1);
+	printf("clip (%d, %d) to (%d, %d)\n", x0, y0, x1, y1);
+	return 0;
+
+usage:
+	printf("%s - clip rect of all drawing, GPU and CPU\n", argv[0]);
+	printf("Usage: %s                     show the clip rect\n"
+		   "       %s <x0> <y0> <x1> <y1> set it, inclusive\n"
+		   "       %s -r                  reset to the screen\n",
+		   argv[0], argv[0], argv[0]);
+	return -1;
+}
+
+/* packs n 48x48 icons into surfaces, draws them there and blits them to the screen */
+static int surface_test(int n)
+{
+	FB_SURFACE	icons[32], screen;
+	const int	size = 48;
+	uint32_t	start_msec, fill_msecs, blit_msecs, free, largest;
+	int			used, cols = fb_width() / size;
+
+	if (n > 32)
+		n = 32;
+	free = surface_heap_info(&largest, &used);
+	for (int i = 0; i < n; i++) {
+		if (surface_alloc(&icons[i], size, size, fb_get_draw_depth()) < 0) {
+			printf("out of surface memory after %d\n", i);
+			n = i;
+			break;
+		}
+	}
+	printf("%d surfaces %dx%d, stride %d: %ld bytes (%ld with 2048 byte lines)\n", n, size,
+		   size, n ? icons[0].stride : 0, free - surface_heap_info(&largest, &used),
+		   (uint32_t)n * size * LCD_WIDTH * LCD_PIXELBYTES);
+
+	start_msec = systime_msec();
+	for (int i = 0; i < n; i++) {
+		surface_clear(&icons[i], colornames[i % 16].value);
+		surface_fill_rect(&icons[i], 8, 8, size - 16, size - 16, colornames[(i + 8) % 16].value);
+		/* partly outside, clipped to the icon */
+		surface_fill_rect(&icons[i], size - 12, -4, 16, 16, colornames[(i + 4) % 16].value);
+	}
+	fill_msecs = systime_msec() - start_msec;
+
+	surface_screen(&screen, LCD_FBADDR);
+	start_msec = systime_msec();
+	for (int i = 0; i < n; i++)
+		surface_blit(&icons[i], 0, 0, &screen, (i % cols) * size, (i / cols) * size, size, size);
+	blit_msecs = systime_msec() - start_msec;
+	printf("draw: %ld msecs, blit to screen: %ld msecs\n", fill_msecs, blit_msecs);
+
+	for (int i = 0; i < n; i++)
+		surface_free(&icons[i]);
+	return 0;
+}
+
+int cmd_surface(int argc, char *argv[])
+{
+	uint32_t free, largest;
+	int		 used;
+
+	if (anyopts(argc, argv, "-h") > 0)
+		goto usage;
+	if (argc > 1 && strcmp(argv[1], "-t") == 0) {
+		if (!(*GPU_CAPS & GPU_CAP_SURFACE)) {
+			printf("no render targets in this bitstream\n");
+			return -1;
+		}
+		return surface_test(argc > 2 ? strtol(argv[2], NULL, 0) : 32);
+	}
+	else if (argc > 1)
+		goto usage;
+	surface_heap_dump();
+	free = surface_heap_info(&largest, &used);
+	printf("%d surfaces, %ld bytes free, largest %ld\n", used, free, largest);
+	return 0;
+
+usage:
+	printf("%s - off-screen surfaces\n", argv[0]);
+	printf("Usage: %s          show the surface heap\n"
+		   "       %s -t [n]   draw n icons in surfaces and blit them\n",
+		   argv[0], argv[0]);
+	return -1;
+}
+
+/* random triangles of two sizes, flat and shaded; pixels are the covered area */
+static int triangle_test(int n)
+{
+	static const int sizes[] = {32, 256};
+	uint32_t		 seed = 1, start_msec, msecs, pixels;
+	FB_VERTEX		 v[3];
+
+	for (int s = 0; s < 2; s++) {
+		for (int shaded = 0; shaded < 2; shaded++) {
+			int size = sizes[s];
+			if (size >= fb_width() || size >= fb_height())
+				break;
+			pixels = 0;
+			start_msec = systime_msec();
+			for (int i = 0; i < n; i++) {
+				seed ^= seed << 13, seed ^= seed >> 17, seed ^= seed << 5;
+				int cx = (seed & 0xffff) % (fb_width() - size);
+				int cy = (seed >> 16) % (fb_height() - size);
+				for (int k = 0; k < 3; k++) {
+					seed ^= seed << 13, seed ^= seed >> 17, seed ^= seed << 5;
+					v[k].x = cx + (seed & 0xffff) % size;
+					v[k].y = cy + (seed >> 16) % size;
+					v[k].argb = colornames[(i + k) % 16].value;
+				}
+				gpu_triangle(&v[0], &v[1], &v[2], shaded);
+				pixels += abs((v[1].x - v[0].x) * (v[2].y - v[0].y) -
+							  (v[2].x - v[0].x) * (v[1].y - v[0].y)) / 2;
+			}
+			msecs = systime_msec() - start_msec;
+			printf("%s %3d: %d tris, %ld msecs, %ld tris/s, %ld pixels/s\n",
+				   shaded ? "shaded" : "flat  ", size, n, msecs, msecs ? n * 1000 / msecs : 0,
+				   msecs ? pixels / msecs * 1000 : 0);
+		}
+	}
+	return 0;
+}
+
+int cmd_triangle(int argc, char *argv[])
+{
+	FB_VERTEX v[3];
+	bool	  shaded = false;
+	int		  argi = 1;
+
+	if (anyopts(argc, argv, "-h") > 0)
+		goto usage;
+	if (!(*GPU_CAPS & GPU_CAP_TRAP)) {
+		printf("no triangles in this bitstream\n");
+		return -1;
+	}
+	if (argc > 1 && strcmp(argv[1], "-t") == 0)
+		return triangle_test(argc > 2 ? strtol(argv[2], NULL, 0) : 1000);
+	if (argc > 1 && strcmp(argv[1], "-g") == 0) {
+		shaded = true;
+		argi = 2;
+	}
+	if (argc < argi + 6)
+		goto usage;
+	for (int k = 0; k < 3; k++) {
+		v[k].x = strtol(argv[argi + 2 * k], NULL, 0);
+		v[k].y = strtol(argv[argi + 2 * k + 1], NULL, 0);
+		v[k].argb = lcd_regs->argb;
+	}
+	argi += 6;
+	for (int k = 0; k < 3 && argi < argc; k++, argi++)
+		if (str2argb32(argv[argi], &v[k].argb) != 0)
+			goto usage;
+	if (gpu_triangle(&v[0], &v[1], &v[2], shaded) < 0)
+		goto usage;
+	return 0;
+
+usage:
+	printf("%s - GPU triangles\n", argv[0]);
+	printf("Usage: %s <x0> <y0> <x1> <y1> <x2> <y2> [color]\n"
+		   "       %s -g <x0> <y0> <x1> <y1> <x2> <y2> <c0> <c1> <c2>  shaded\n"
+		   "       %s -t [n]   time n random triangles, flat and shaded\n",
+		   argv[0], argv[0], argv[0]);
+	return -1;
+}
+
+/* whole work surface gradients against a solid fill of it */
+static int gradient_test(void)
+{
+	static const char *names[] = {"fill", "linear", "linear dithered", "radial"};
+	FB_VERTEX		   from = {0, 0, 0xff000000};
+	FB_VERTEX		   to = {fb_width() - 1, fb_height() - 1, 0xffffffff};
+	FB_VERTEX		   center = {fb_width() / 2, fb_height() / 2, 0xffffffff};
+	uint32_t		   pixels = fb_width() * fb_height(), start_msec, msecs;
+	const int		   rounds = 10;
+
+	for (int k = 0; k < 4; k++) {
+		start_msec = systime_msec();
+		for (int i = 0; i < rounds; i++) {
+			if (k == 0)
+				gpu_fill_rect(lcd_regs->workaddr, 0, 0, fb_width(), fb_height(), from.argb);
+			else if (k < 3)
+				gpu_gradient_linear(0, 0, fb_width(), fb_height(), &from, &to, k == 2);
+			else
+				gpu_gradient_radial(0, 0, fb_width(), fb_height(), &center, fb_height() / 2,
+									0xff000000, true);
+		}
+		msecs = systime_msec() - start_msec;
+		printf("%-16s %ld.%ld msecs, %ld Kpixels/s\n", names[k], msecs / rounds, msecs % rounds,
+			   msecs ? pixels / msecs * rounds : 0);
+	}
+	return 0;
+}
+
+int cmd_gradient(int argc, char *argv[])
+{
+	FB_VERTEX v[2];
+	uint32_t  outer;
+	bool	  dither = false, radial = false;
+	int		  argi = 1;
+
+	if (anyopts(argc, argv, "-h") > 0)
+		goto usage;
+	if (!(*GPU_CAPS & GPU_CAP_GRAD)) {
+		printf("no gradients in this bitstream\n");
+		return -1;
+	}
+	if (anyopts(argc, argv, "-t") > 0)
+		return gradient_test();
+	for (; argi < argc; argi++) {
+		if (strcmp(argv[argi], "-d") == 0)
+			dither = true;
+		else if (strcmp(argv[argi], "-r") == 0)
+			radial = true;
+		else
+			break;
+	}
+	if (radial) {
+		if (argc != argi + 5)
+			goto usage;
+		v[0].x = strtol(argv[argi], NULL, 0);
+		v[0].y = strtol(argv[argi + 1], NULL, 0);
+		if (str2argb32(argv[argi + 3], &v[0].argb) != 0 ||
+			str2argb32(argv[argi + 4], &outer) != 0)
+			goto usage;
+		if (gpu_gradient_radial(0, 0, fb_width(), fb_height(), &v[0],
+								strtol(argv[argi + 2], NULL, 0), outer, dither) < 0)
+			goto usage;
+		return 0;
+	}
+	if (argc != argi + 6)
+		goto usage;
+	for (int k = 0; k < 2; k++) {
+		v[k].x = strtol(argv[argi + 3 * k], NULL, 0);
+		v[k].y = strtol(argv[argi + 3 * k + 1], NULL, 0);
+		if (str2argb32(argv[argi + 3 * k + 2], &v[k].argb) != 0)
+			goto usage;
+	}
+	if (gpu_gradient_linear(0, 0, fb_width(), fb_height(), &v[0], &v[1], dither) < 0)
+		goto usage;
+	return 0;
+
+usage:
+	printf("%s - GPU gradient fill of the work surface\n", argv[0]);
+	printf("Usage: %s [-d] <x0> <y0> <c0> <x1> <y1> <c1>  linear from x0,y0 to x1,y1\n"
+		   "       %s [-d] -r <cx> <cy> <r> <c0> <c1>     radial, r >= %d\n"
+		   "       %s -t   time gradients against a solid fill\n"
+		   "       -d dithers to RGB565\n",
+		   argv[0], argv[0], GRAD_RADIUS_MIN, argv[0]);
+	return -1;
+}
+
+/* zoom, shrink and rotations of a 256 x 256 surface, pixels are the target's */
+static int xblit_test(void)
+{
+	static const struct {
+		const char *name;
+		int			size, rot;
+	} runs[] = {
+		{"1:1", 256, XFORM_ROT0},		 {"zoom 2x", 512, XFORM_ROT0},
+		{"zoom 1.5x", 384, XFORM_ROT0},	 {"shrink 1/2", 128, XFORM_ROT0},
+		{"rotate 90", 256, XFORM_ROT90}, {"rotate 180", 256, XFORM_ROT180},
+		{"rotate 270", 256, XFORM_ROT270},
+	};
+	FB_SURFACE src = {0}, dst = {0}, screen;
+	uint32_t   start_msec, msecs;
+	const int  rounds = 10;
+
+	if (surface_alloc(&src, 256, 256, FBMODE_BPP16) < 0 ||
+		surface_alloc(&dst, 512, 512, FBMODE_BPP16) < 0) {
+		printf("out of surface memory\n");
+		surface_free(&src);
+		return -1;
+	}
+	/* quadrants and a corner mark, to see the orientation */
+	for (int q = 0; q < 4; q++)
+		surface_fill_rect(&src, (q & 1) * 128, (q >> 1) * 128, 128, 128, colornames[9 + q].value);
+	surface_fill_rect(&src, 8, 8, 32, 16, colornames[15].value);
+
+	start_msec = systime_msec();
+	for (int i = 0; i < rounds; i++)
+		surface_blit(&src, 0, 0, &dst, 0, 0, 256, 256);
+	msecs = systime_msec() - start_msec;
+	printf("%-12s %ld.%ld msecs, %ld Kpixels/s\n", "blit", msecs / rounds, msecs % rounds,
+		   msecs ? 256 * 256 / msecs * rounds : 0);
+	for (unsigned k = 0; k < sizeof(runs) / sizeof(runs[0]); k++) {
+		int size = runs[k].size;
+		start_msec = systime_msec();
+		for (int i = 0; i < rounds; i++)
+			surface_blit_scaled(&src, 0, 0, 256, 256, &dst, 0, 0, size, size, runs[k].rot);
+		msecs = systime_msec() - start_msec;
+		printf("%-12s %ld.%ld msecs, %ld Kpixels/s\n", runs[k].name, msecs / rounds,
+			   msecs % rounds, msecs ? (uint32_t)size * size / msecs * rounds : 0);
+	}
+	surface_screen(&screen, lcd_regs->workaddr);
+	if (screen.depth == FBMODE_BPP16)
+		surface_blit(&dst, 0, 0, &screen, 0, 0, 256, 256);
+	surface_free(&dst);
+	surface_free(&src);
+	return 0;
+}
+
+int cmd_xblit(int argc, char *argv[])
+{
+	FB_SURFACE src, dst;
+	int		   rot = XFORM_ROT0, argi = 1, a[8];
+
+	if (anyopts(argc, argv, "-h") > 0)
+		goto usage;
+	if (!(*GPU_CAPS & GPU_CAP_XFORM)) {
+		printf("no transform blits in this bitstream\n");
+		return -1;
+	}
+	if (anyopts(argc, argv, "-t") > 0)
+		return xblit_test();
+	if (argc > 2 && strcmp(argv[1], "-r") == 0) {
+		int deg = strtol(argv[2], NULL, 0);
+		if (deg % 90 != 0 || deg < 0 || deg > 270)
+			goto usage;
+		rot = deg / 90;
+		argi = 3;
+	}
+	if (argc != argi + 8)
+		goto usage;
+	for (int k = 0; k < 8; k++)
+		a[k] = strtol(argv[argi + k], NULL, 0);
+	surface_screen(&src, lcd_regs->dispaddr);
+	surface_screen(&dst, lcd_regs->workaddr);
+	if (surface_blit_scaled(&src, a[0], a[1], a[2], a[3], &dst, a[4], a[5], a[6], a[7], rot) < 0)
+		goto usage;
+	return 0;
+
+usage:
+	printf("%s - scaled and rotated blit, 16bpp\n", argv[0]);
+	printf("Usage: %s [-r 90|180|270] <sx> <sy> <sw> <sh> <dx> <dy> <dw> <dh>\n"
+		   "           from the shown screen to the work surface, clockwise\n"
+		   "       %s -t   time zoom, shrink and rotations between surfaces\n",
+		   argv[0], argv[0]);
+	return -1;
+}
+
+/* span i of list, or a FRECT of it on the work surface without a list */
+static void span_out(FB_SPAN *list, int i, int x0, int x1, int y, uint16_t color)
+{
+	if (list)
+		span_set(&list[i], x0, x1, y, color);
+	else {
+		FB_SURFACE screen;
+		surface_screen(&screen, lcd_regs->workaddr);
+		surface_fill_rect(&screen, x0, y, x1 - x0 + 1, 1, lcd_regs->argb);
+	}
+}
+
+/* a filled disc as 2 * r + 1 spans, in rainbow bands with colors; returns its pixels */
+static uint32_t disc_spans(FB_SPAN *list, int xm, int ym, int r, bool colors)
+{
+	uint32_t pixels = 0;
+	int		 n = 0;
+
+	for (int dy = 0, x = r; dy <= r; dy++) {
+		while (x * x + dy * dy > r * r)
+			x--;
+		int		 k = 9 + dy / 4 % 7;
+		uint16_t c = 0;
+		if (colors)
+			c = (fb_get_draw_depth() == FBMODE_BPP16) ? argb2rgb565(colornames[k].value) : k;
+		span_out(list, n++, xm - x, xm + x, ym + dy, c);
+		pixels += 2 * x + 1;
+		if (dy) {
+			span_out(list, n++, xm - x, xm + x, ym - dy, c);
+			pixels += 2 * x + 1;
+		}
+	}
+	return pixels;
+}
+
+/* random discs, a FRECT per span against one span list each */
+static int spans_test(int n)
+{
+	static const int   radii[] = {16, 128};
+	static const char *names[] = {"frect", "spans", "spans color"};
+	FB_SPAN			  *list = (FB_SPAN *)surface_heap_alloc((2 * 128 + 1) * sizeof(FB_SPAN));
+	uint32_t		   seed, start_msec, msecs, pixels;
+
+	if (!list) {
+		printf("out of surface memory\n");
+		return -1;
+	}
+	for (int s = 0; s < 2; s++) {
+		int r = radii[s];
+		if (2 * r >= fb_width() || 2 * r >= fb_height())
+			break;
+		for (int k = 0; k < 3; k++) {
+			seed = 1;
+			pixels = 0;
+			start_msec = systime_msec();
+			for (int i = 0; i < n; i++) {
+				seed ^= seed << 13, seed ^= seed >> 17, seed ^= seed << 5;
+				int xm = r + (seed & 0xffff) % (fb_width() - 2 * r);
+				int ym = r + (seed >> 16) % (fb_height() - 2 * r);
+				pixels += disc_spans(k ? list : NULL, xm, ym, r, k == 2);
+				if (k)
+					gpu_fill_spans(list, 2 * r + 1, lcd_regs->argb, k == 2);
+			}
+			msecs = systime_msec() - start_msec;
+			printf("%-12s %3d: %d discs, %ld msecs, %ld Kpixels/s\n", names[k], r, n, msecs,
+				   msecs ? pixels / msecs : 0);
+		}
+	}
+	surface_heap_free((uint32_t)list);
+	return 0;
+}
+
+int cmd_spans(int argc, char *argv[])
+{
+	FB_SPAN *list;
+	bool	 colors = false;
+	int		 argi = 1, xm, ym, r;
+	uint32_t argb = lcd_regs->argb;
+
+	if (anyopts(argc, argv, "-h") > 0)
+		goto usage;
+	if (!(*GPU_CAPS & GPU_CAP_SPANS)) {
+		printf("no span lists in this bitstream\n");
+		return -1;
+	}
+	if (argc > 1 && strcmp(argv[1], "-t") == 0)
+		return spans_test(argc > 2 ? strtol(argv[2], NULL, 0) : 100);
+	if (argc > 1 && strcmp(argv[1], "-c") == 0) {
+		colors = true;
+		argi = 2;
+	}
+	if (argc != argi + 3 && argc != argi + 4)
+		goto usage;
+	xm = strtol(argv[argi], NULL, 0);
+	ym = strtol(argv[argi + 1], NULL, 0);
+	r = strtol(argv[argi + 2], NULL, 0);
+	if (r < 0 || r > TRI_COORD_MAX || (argc == argi + 4 && str2argb32(argv[argi + 3], &argb) != 0))
+		goto usage;
+	list = (FB_SPAN *)surface_heap_alloc((2 * r + 1) * sizeof(FB_SPAN));
+	if (!list) {
+		printf("out of surface memory\n");
+		return -1;
+	}
+	disc_spans(list, xm, ym, r, colors);
+	gpu_fill_spans(list, 2 * r + 1, argb, colors);
+	surface_heap_free((uint32_t)list);
+	return 0;
+
+usage:
+	printf("%s - filled discs from GPU span lists\n", argv[0]);
+	printf("Usage: %s [-c] <xm> <ym> <r> [color]   -c in rainbow bands of span colors\n"
+		   "       %s -t [n]   time n discs, a FRECT per span against a span list\n",
+		   argv[0], argv[0]);
+	return -1;
+}
+
+/* SRAM for the copy tests, flash as some of the code */
+static uint32_t sram_test_buf[256];
+#define FLASH_TEST_SRC ((uint32_t)cmd_help)
+
+static void cpu_copy(uint32_t dst, uint32_t src, uint32_t n)
+{
+	volatile uint32_t *d = (uint32_t *)dst;
+	volatile uint32_t *s = (uint32_t *)src;
+
+	for (n /= 4; n; n--)
+		*d++ = *s++;
+}
+
+/* CPU word copies against the DMA engine between the memories */
+static int dma_test(void)
+{
+	static const char *names[] = {"sram->psram", "psram->psram", "flash->psram", "psram->sram"};
+	uint32_t		   sram = (uint32_t)sram_test_buf;
+	uint32_t		   a = surface_heap_alloc(0x8000), b = surface_heap_alloc(0x8000);
+	uint32_t		   start_msec, msecs[2];
+	const int		   rounds = 16;
+
+	if (!a || !b) {
+		printf("out of surface memory\n");
+		surface_heap_free(a);
+		surface_heap_free(b);
+		return -1;
+	}
+	for (int k = 0; k < 4; k++) {
+		uint32_t dst = (k == 3) ? sram : b;
+		uint32_t src = (k == 0) ? sram : (k == 2) ? FLASH_TEST_SRC : a;
+		uint32_t n = (k == 0 || k == 3) ? sizeof(sram_test_buf) : 0x8000;
+		for (int m = 0; m < 2; m++) {
+			start_msec = systime_msec();
+			for (int i = 0; i < rounds; i++) {
+				if (m)
+					dma_copy(dst, src, n);
+				else
+					cpu_copy(dst, src, n);
+			}
+			msecs[m] = systime_msec() - start_msec;
+		}
+		printf("%-13s %6ld bytes: cpu %4ld KB/s, dma %4ld KB/s%s\n", names[k], n,
+			   msecs[0] ? n * rounds / msecs[0] : 0, msecs[1] ? n * rounds / msecs[1] : 0,
+			   memcmp((void *)dst, (void *)src, n) ? " MISMATCH" : "");
+	}
+	surface_heap_free(a);
+	surface_heap_free(b);
+	return 0;
+}
+
+int cmd_dma(int argc, char *argv[])
+{
+	uint32_t dst, src, n, stat;
+	int		 waitcount;
+
+	if (anyopts(argc, argv, "-h") > 0)
+		goto usage;
+	if (!dma_available()) {
+		printf("no DMA engine in this bitstream\n");
+		return -1;
+	}
+	if (argc == 1) {
+		stat = dma_status();
+		printf("status 0x%02lX%s%s%s, desc 0x%08lX, moved %ld bytes\n", stat,
+			   (stat & DMA_STAT_BUSY) ? " busy" : "", (stat & DMA_STAT_DONE) ? " done" : "",
+			   (stat & DMA_STAT_ERROR) ? " error" : "", dma_regs->cur, dma_regs->moved);
+		return 0;
+	}
+	if (argc == 2 && strcmp(argv[1], "-t") == 0)
+		return dma_test();
+	if (argc != 4)
+		goto usage;
+	dst = strtoul(argv[1], NULL, 0);
+	src = strtoul(argv[2], NULL, 0);
+	n = strtoul(argv[3], NULL, 0);
+	waitcount = dma_copy(dst, src, n);
+	if (waitcount < 0) {
+		printf("%s: failed, status 0x%02lX\n", argv[0], dma_status());
+		return -1;
+	}
+	printf("%ld bytes, waitcount %d\n", dma_regs->moved, waitcount);
+	return 0;
+
+usage:
+	printf("%s - descriptor DMA between SRAM, PSRAM and flash\n", argv[0]);
+	printf("Usage: %s   show the status of the last chain\n"
+		   "       %s <dst> <src> <bytes>   copy, all a multiple of 4, dst not in flash\n"
+		   "       %s -t   time CPU word copies against DMA\n",
+		   argv[0], argv[0], argv[0]);
+	return -1;
+}
+
+/* cycles per call of fn(dst, src, n), as memset(dst, 0x55, n) without src */
+static uint32_t memops_time(int fn, void *dst, const void *src, size_t n)
+{
+	const int rounds = 8;
+	uint32_t  start = cpu_cycles();
+
+	for (int i = 0; i < rounds; i++) {
+		switch (fn) {
+		case 0:
+			mem_copy_bytes(dst, src, n);
+			break;
+		case 1:
+			memcpy(dst, src, n);
+			break;
+		case 2:
+			mem_set_bytes(dst, 0x55, n);
+			break;
+		default:
+			memset(dst, 0x55, n);
+			break;
+		}
+	}
+	return (cpu_cycles() - start) / rounds;
+}
+
+/* byte loops against memcpy/memset per region and size, aligned and not */
+static int memops_test(void)
+{
+	static const char	*names[] = {"sram<-sram",  "sram<-flash",  "sram<-psram", "psram<-sram",
+									"psram<-psram", "psram<-flash", "set sram",	   "set psram"};
+	static const uint32_t sizes[] = {8, 64, 480, 4096};
+	uint8_t				*sram = (uint8_t *)sram_test_buf;
+	uint8_t				*a = (uint8_t *)surface_heap_alloc(0x2000), *b = a + 0x1000;
+	uint32_t			 bytes, fast, skew;
+
+	if (!a) {
+		printf("out of surface memory\n");
+		return -1;
+	}
+	printf("cycles per call, DMA %s\n", mem_uses_dma() ? "on" : "off");
+	printf("%-13s %5s %8s %8s %8s\n", "", "bytes", "loop", "aligned", "src+1");
+	for (int k = 0; k < 8; k++) {
+		uint8_t *dst = (k < 3 || k == 6) ? sram : a;
+		uint8_t *src = (k == 0 || k == 3) ? sram + 512 : b;
+		if (k == 1 || k == 5)
+			src = (uint8_t *)FLASH_TEST_SRC;
+		for (int i = 0; i < ARRAY_SIZE(sizes); i++) {
+			uint32_t n = sizes[i];
+			if (n > 480 && (dst == sram || src == sram + 512))
+				continue;
+			if (k < 6) {
+				bytes = memops_time(0, dst, src, n);
+				fast = memops_time(1, dst, src, n);
+				skew = memops_time(1, dst, src + 1, n);
+				if (memcmp(dst, src + 1, n))
+					printf("%s %ld bytes: MISMATCH\n", names[k], n);
+			} else {
+				bytes = memops_time(2, dst, NULL, n);
+				fast = memops_time(3, dst, NULL, n);
+				skew = memops_time(3, dst + 1, NULL, n);
+			}
+			printf("%-13s %5ld %8ld %8ld %8ld\n", names[k], n, bytes, fast, skew);
+		}
+	}
+	surface_heap_free((uint32_t)a);
+	return 0;
+}
+
+int cmd_memops(int argc, char *argv[])
+{
+	if (anyopts(argc, argv, "-h") > 0)
+		goto usage;
+	if (argc == 2 && strcmp(argv[1], "-t") == 0)
+		return memops_test();
+	if (argc == 3 && strcmp(argv[1], "-d") == 0) {
+		mem_use_dma(strcmp(argv[2], "on") == 0);
+		printf("large PSRAM moves by DMA %s\n", mem_uses_dma() ? "on" : "off");
+		return 0;
+	}
+	if (argc != 1)
+		goto usage;
+	printf("large PSRAM moves (from %d bytes) by DMA %s\n", MEM_DMA_MIN,
+		   mem_uses_dma() ? "on" : "off");
+	return 0;
+
+usage:
+	printf("%s - memcpy/memset in words and PSRAM lines\n", argv[0]);
+	printf("Usage: %s -t   time byte loops against memcpy/memset per region and size\n"
+		   "       %s -d on|off   move large PSRAM blocks by DMA, if there is one\n",
+		   argv[0], argv[0]);
+	return -1;
+}
+
+/*
+ * membench kernels, run from SRAM so that instruction fetches leave the
+ * flash and the bus to the loads and stores being measured.
+ */
+static RAMFUNC uint32_t mb_read(const uint8_t *p, uint32_t n, uint32_t stride)
+{
+	uint32_t sum = 0;
+
+	for (const uint8_t *end = p + n; p < end; p += stride)
+		sum += *(volatile const uint32_t *)p;
+	return sum;
+}
+
+static RAMFUNC void mb_write(uint8_t *p, uint32_t n, uint32_t stride)
+{
+	for (uint8_t *end = p + n; p < end; p += stride)
+		*(volatile uint32_t *)p = (uint32_t)p;
+}
+
+/*
+ * count loads in a walk over the mask + 1 nodes stride bytes apart, node
+ * i followed by 5i + 1: full period for a power of 2 node count, so every
+ * node is hit once per lap. Each address waits for the load before it.
+ * Without load the same walk times the loop around it.
+ */
+static RAMFUNC uint32_t mb_chase(const uint8_t *base, uint32_t mask, int shift, int count,
+								 bool load)
+{
+	uint32_t i = 0, v = 0;
+
+	while (count--) {
+		if (load)
+			v = *(volatile const uint32_t *)(base + (i << shift));
+		/* v & 0, opaque to the compiler */
+		__asm__("and %0, %0, zero" : "+r"(v));
+		i = ((i << 2) + i + 1 + v) & mask;
+	}
+	return i;
+}
+
+/* KB/s of bytes moved in cycles */
+static uint32_t mb_kbps(uint32_t bytes, uint32_t cycles)
+{
+	return cycles ? (uint64_t)bytes * (CLK_FREQ / 1000) / cycles : 0;
+}
+
+/* one table row; no dst is a read-only region, copied into SRAM instead */
+static void mb_row(const char *name, uint8_t *src, uint8_t *dst, uint32_t n, uint32_t stride)
+{
+	const int rounds = 4;
+	uint32_t  nodes = n / stride, steps = MAX(nodes, 1024);
+	uint32_t  loaded = nodes * rounds * 4;
+	uint32_t  start, rd, wr = 0, cp, lat, loop;
+	int		  shift = __builtin_ctz(stride);
+
+	start = cpu_cycles();
+	for (int i = 0; i < rounds; i++)
+		mb_read(src, n, stride);
+	rd = cpu_cycles() - start;
+	if (dst) {
+		start = cpu_cycles();
+		for (int i = 0; i < rounds; i++)
+			mb_write(dst, n, stride);
+		wr = cpu_cycles() - start;
+	}
+	start = cpu_cycles();
+	for (int i = 0; i < rounds; i++)
+		memcpy(dst ? dst : (uint8_t *)sram_test_buf, src, n);
+	cp = cpu_cycles() - start;
+	/* whole laps, both powers of 2 */
+	start = cpu_cycles();
+	mb_chase(src, nodes - 1, shift, steps, true);
+	lat = cpu_cycles() - start;
+	start = cpu_cycles();
+	mb_chase(src, nodes - 1, shift, steps, false);
+	loop = cpu_cycles() - start;
+	lat = lat > loop ? lat - loop : 0;
+
+	printf("%-12s %6ld %6ld ", name, n, stride);
+	printf("%8ld ", mb_kbps(loaded, rd));
+	if (dst)
+		printf("%8ld ", mb_kbps(loaded, wr));
+	else
+		printf("%8s ", "-");
+	printf("%8ld %4ld.%ld\n", mb_kbps(n * rounds, cp), lat / steps, lat * 10 / steps % 10);
+}
+
+/* SRAM, flash in each read mode and PSRAM under full and minimal scanout */
+static int membench(uint32_t n, uint32_t stride, const char *only)
+{
+	static const char *flash_names[] = {"flash spi", "flash dspi", "flash crm"};
+	uint8_t			  *sram = (uint8_t *)sram_test_buf;
+	uint8_t			  *flash = (uint8_t *)FLASH_TEST_SRC;
+	uint8_t			  *psram;
+	uint32_t		   sram_n = MIN(n, sizeof(sram_test_buf) / 2);
+	int				   crm = cmd_get_crm(), dspi = cmd_get_dspi();
+
+	psram = (uint8_t *)surface_heap_alloc(2 * n);
+	if (!psram) {
+		printf("out of surface memory\n");
+		return -1;
+	}
+	printf("%-12s %6s %6s %8s %8s %8s %6s\n", "region", "bytes", "stride", "rd KB/s", "wr KB/s",
+		   "cp KB/s", "lat cy");
+	if (!only || strcmp(only, "sram") == 0)
+		mb_row("sram", sram + sizeof(sram_test_buf) / 2, sram, sram_n, MIN(stride, sram_n));
+	if (!only || strcmp(only, "flash") == 0) {
+		for (int m = 0; m < 3; m++) {
+			cmd_set_dspi(m > 0);
+			cmd_set_crm(m > 1);
+			mb_row(flash_names[m], flash, NULL, sram_n, MIN(stride, sram_n));
+		}
+		cmd_set_crm(crm);
+		cmd_set_dspi(dspi);
+	}
+	if (!only || strcmp(only, "psram") == 0) {
+		uint32_t mode = lcd_regs->fbmode, frame;
+
+		mb_row("psram", psram + n, psram, n, stride);
+		if (*GPU_CAPS & GPU_CAP_SCALED) {
+			/* 4 bpp at 4x is the least scanout there is */
+			lcd_regs->fbmode = (mode & FBMODE_DRAW_MASK) | FBMODE_SCAN(FBMODE_BPP4) |
+							   FBMODE_SCALE(2);
+			for (int i = 0; i < 2; i++)
+				for (frame = lcd_regs->frames; frame == lcd_regs->frames;)
+					;
+			mb_row("psram idle", psram + n, psram, n, stride);
+			lcd_regs->fbmode = mode;
+		}
+	}
+	surface_heap_free((uint32_t)psram);
+	return 0;
+}
+
+int cmd_membench(int argc, char *argv[])
+{
+	uint32_t	n = 4096, stride = 4;
+	const char *only = NULL;
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			n = strtoul(argv[++i], NULL, 0);
+		else if (strcmp(argv[i], "-S") == 0 && i + 1 < argc)
+			stride = strtoul(argv[++i], NULL, 0);
+		else if (!only && (strcmp(argv[i], "sram") == 0 || strcmp(argv[i], "flash") == 0 ||
+						   strcmp(argv[i], "psram") == 0))
+			only = argv[i];
+		else
+			goto usage;
+	}
+	/* powers of 2, so the latency walk wraps with a mask */
+	if (n < 8 || n > 0x10000 || (n & (n - 1)) || stride < 4 || stride > n || (stride & (stride - 1)))
+		goto usage;
+	return membench(n, stride, only);
+
+usage:
+	printf("%s - memory throughput and dependent load latency in CPU cycles\n", argv[0]);
+	printf("Usage: %s [-s bytes] [-S stride] [sram|flash|psram]\n"
+		   "           bytes 8..65536 (SRAM and flash up to %d), stride 4..bytes, both\n"
+		   "           powers of 2; flash is timed in SPI, DSPI and DSPI+CRM mode,\n"
+		   "           PSRAM under full and 4 bpp 4x scanout, copies use memcpy\n",
+		   argv[0], (int)sizeof(sram_test_buf) / 2);
+	return -1;
+}
+
+static uint32_t gb_seed, gb_start_msec, gb_start_cycles;
+
+static uint32_t gb_rand(uint32_t range)
+{
+	gb_seed ^= gb_seed << 13, gb_seed ^= gb_seed >> 17, gb_seed ^= gb_seed << 5;
+	return gb_seed % range;
+}
+
+static uint32_t gb_color(void)
+{
+	return 0xff000000 | gb_rand(0x1000000);
+}
+
+static void gb_begin(void)
+{
+	gb_start_msec = systime_msec();
+	gb_start_cycles = cpu_cycles();
+}
+
+/* one CSV row, rates from the cycle count */
+static void gb_end(const char *name, int arg, uint32_t ops, uint32_t pixels)
+{
+	uint32_t cycles = cpu_cycles() - gb_start_cycles;
+	uint32_t msecs = systime_msec() - gb_start_msec;
+	char	 key[24];
+
+	snprintf(key, sizeof(key), arg >= 0 ? "%s_%d" : "%s", name, arg);
+	printf("%s,%ld,%ld,%ld,%ld,%ld,%ld\n", key, ops, pixels, msecs, cycles,
+		   cycles ? (uint32_t)((uint64_t)ops * CLK_FREQ / cycles) : 0,
+		   cycles ? (uint32_t)((uint64_t)pixels * CLK_FREQ / cycles) : 0);
+}
+
+/* the points plot_circle draws for radius r, same walk */
+static uint32_t circle_points(int r)
+{
+	int		 x = -r, y = 0, err = 2 - 2 * r;
+	uint32_t n = 0;
+
+	do {
+		n += 4;
+		r = err;
+		if (r > x)
+			err += ++x * 2 + 1;
+		if (r <= y)
+			err += ++y * 2 + 1;
+	} while (x < 0);
+	return n;
+}
+
+/*
+ * A fixed workload from one seed at 16 bpp 1x, every category one CSV
+ * row: name,ops,pixels,msecs,cycles,ops_per_s,pixels_per_s. Diff two runs
+ * of the same seed to compare builds or bitstreams.
+ */
+static void gbench(uint32_t seed)
+{
+	static const int	rect_sizes[][2] = {{8, 256}, {64, 64}, {256, 16}};
+	static const int	circle_radii[][2] = {{8, 200}, {64, 50}};
+	static const int8_t octants[8][2] = {{100, 40}, {40, 100},	 {-40, 100}, {-100, 40},
+										 {-100, -40}, {-40, -100}, {40, -100}, {100, -40}};
+	static const char	text[] = "The quick brown fox jumps over the lazy dog 0123456789";
+	uint32_t			mode = lcd_regs->fbmode, argb = lcd_regs->argb;
+	uint32_t			fb = lcd_regs->workaddr, pixels, pix2;
+	int					w, h, n, cx0, cy0, cx1, cy1;
+
+	fb_get_clip(&cx0, &cy0, &cx1, &cy1);
+	fb_set_scale(0);
+	fb_set_mode(FBMODE_BPP16, FBMODE_BPP16);
+	w = fb_width();
+	h = fb_height();
+	gb_seed = seed ? seed : 1;
+	printf("gbench,1,seed,%ld,caps,0x%08lX,burst,%ld,clk,%d\n", gb_seed, *GPU_CAPS,
+		   GPU_CAP_BURST(*GPU_CAPS), CLK_FREQ);
+	printf("name,ops,pixels,msecs,cycles,ops_per_s,pixels_per_s\n");
+
+	gb_begin();
+	for (int i = 0; i < 4; i++) {
+		lcd_regs->argb = gb_color();
+		gpu_exec(GPU_SETBG);
+	}
+	gb_end("clear_hw", -1, 4, 4 * w * h);
+
+	/* 2 pixels per store, the lines are contiguous at 1x */
+	gb_begin();
+	pix2 = argb2rgb565(gb_color());
+	pix2 |= pix2 << 16;
+	for (volatile uint32_t *p = (uint32_t *)fb; p < (uint32_t *)fb + w * h / 2; p++)
+		*p = pix2;
+	gb_end("clear_sw", -1, 1, w * h);
+
+	for (int k = 0; k < ARRAY_SIZE(rect_sizes); k++) {
+		int size = rect_sizes[k][0];
+		n = rect_sizes[k][1];
+		gb_begin();
+		for (int i = 0; i < n; i++)
+			gpu_fill_rect(fb, gb_rand(w - size), gb_rand(h - size), size, size, gb_color());
+		gb_end("rect", size, n, n * size * size);
+	}
+
+	for (int k = 0; k < 8; k++) {
+		int dx = octants[k][0], dy = octants[k][1];
+		n = 100;
+		gb_begin();
+		for (int i = 0; i < n; i++) {
+			int x = 100 + gb_rand(w - 200), y = 100 + gb_rand(h - 200);
+			plot_line(x, y, x + dx, y + dy, gb_color());
+		}
+		plot_sync();
+		gb_end("line_oct", k, n, n * (MAX(abs(dx), abs(dy)) + 1));
+	}
+
+	for (int k = 0; k < ARRAY_SIZE(circle_radii); k++) {
+		int r = circle_radii[k][0];
+		n = circle_radii[k][1];
+		gb_begin();
+		for (int i = 0; i < n; i++)
+			plot_circle(r + gb_rand(w - 2 * r), r + gb_rand(h - 2 * r), r, gb_color());
+		plot_sync();
+		gb_end("circle", r, n, n * circle_points(r));
+	}
+
+	for (int f = 0; f < fb_font_count(); f++) {
+		int fh = fbfont_hdr(fb_font(f))->height;
+		n = 20;
+		pixels = 0;
+		gb_begin();
+		for (int i = 0; i < n; i++) {
+			int x = gb_rand(w / 4), y = gb_rand(h - fh);
+			pixels += (gcache_puts(fb, x, y, f, text, gb_color(), 0xff000000) - x) * fh;
+		}
+		gb_end("glyphs_cached", f, n * (sizeof(text) - 1), pixels);
+		pixels = 0;
+		gb_begin();
+		for (int i = 0; i < n; i++) {
+			int		 x = gb_rand(w / 4), x0 = x, y = gb_rand(h - fh);
+			uint32_t c = gb_color();
+			for (const char *p = text; *p; p++)
+				x = fb_draw_glyph(fb, x, y, f, *p, c, 0xff000000);
+			pixels += (x - x0) * fh;
+		}
+		gb_end("glyphs_direct", f, n * (sizeof(text) - 1), pixels);
+	}
+
+	n = 10000;
+	gb_begin();
+	for (int i = 0; i < n; i++)
+		plot_point(gb_rand(w), gb_rand(h), gb_color());
+	plot_sync();
+	gb_end("points", -1, n, n);
+
+	fb_set_mode(FBMODE_SCAN(mode), (mode & FBMODE_DRAW_MASK) >> 8);
+	fb_set_scale((mode & FBMODE_SCALE_MASK) >> 4);
+	/* after the scale, which resets the clip */
+	fb_set_clip(cx0, cy0, cx1, cy1);
+	lcd_regs->argb = argb;
+}
+
+int cmd_gbench(int argc, char *argv[])
+{
+	if (anyopts(argc, argv, "-h") > 0 || argc > 2)
+		goto usage;
+	gbench(argc > 1 ? strtoul(argv[1], NULL, 0) : 1);
+	return 0;
+
+usage:
+	printf("%s - fixed drawing workload, one CSV row per category\n", argv[0]);
+	printf("Usage: %s [seed]   same seed, same work; rates per second from rdcycle\n",
+		   argv[0]);
+	return -1;
+}
+
+#ifdef CPUMARK
+int cmd_cpumark(int argc, char *argv[])
+{
+	static const char *where[] = {"flash", "sram"};
+	int				   n = CPUMARK_RUNS;
+	uint32_t		   cycles;
+	int				   err = 0;
+
+	if (anyopts(argc, argv, "-h") > 0 || argc > 2)
+		goto usage;
+	if (argc > 1)
+		n = strtol(argv[1], NULL, 0);
+	if (n <= 0)
+		goto usage;
+#ifdef __riscv_mul
+	printf("Dhrystone 2.1, rv32im, %d runs, %d MHz\n", n, CLK_FREQ / 1000000);
+#else
+	printf("Dhrystone 2.1, rv32i, %d runs, %d MHz\n", n, CLK_FREQ / 1000000);
+#endif
+	for (int ram = 0; ram < 2; ram++) {
+		err |= cpumark_run(n, ram, &cycles);
+		/* DMIPS and DMIPS/MHz in thousandths */
+		uint32_t dps = (uint64_t)n * CLK_FREQ / cycles;
+		uint32_t dmips = (uint64_t)n * CLK_FREQ * 1000 / cycles / CPUMARK_VAX_DHRY_S;
+		uint32_t dpm = (uint64_t)n * 1000000 * 1000 / cycles / CPUMARK_VAX_DHRY_S;
+		printf("%-5s %10ld cycles, %ld cycles/run, %ld Dhrystones/s, %ld.%03ld DMIPS, "
+			   "%ld.%03ld DMIPS/MHz\n",
+			   where[ram], cycles, cycles / n, dps, dmips / 1000, dmips % 1000, dpm / 1000,
+			   dpm % 1000);
+	}
+	if (err)
+		printf("WRONG RESULTS\n");
+	return 0;
+
+usage:
+	printf("%s - Dhrystone 2.1\n", argv[0]);
+	printf("Usage: %s [runs]   run from the flash XIP and from SRAM, default %d\n", argv[0],
+		   CPUMARK_RUNS);
 	return -1;
 }
+#endif
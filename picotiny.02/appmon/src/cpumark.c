@@ -0,0 +1,144 @@
+#ifdef CPUMARK
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "hwdefs.h"
+#include "sysutils.h"
+#include "cpumark.h"
+
+/* dhry.h types */
+typedef enum { Ident_1, Ident_2, Ident_3, Ident_4, Ident_5 } Enumeration;
+
+typedef int	 One_Thirty;
+typedef int	 One_Fifty;
+typedef char Capital_Letter;
+typedef int	 Boolean;
+typedef char Str_30[31];
+typedef int	 Arr_1_Dim[50];
+/*
+ * 50x50 ints would take 10k of the 8k SRAM. Dhrystone only touches
+ * rows 8 and 28, columns 7 to 9, so the rows are cut to 30 and the
+ * columns to 10.
+ */
+typedef int Arr_2_Dim[30][10];
+
+typedef struct record {
+	struct record *Ptr_Comp;
+	Enumeration	   Discr;
+	union {
+		struct {
+			Enumeration Enum_Comp;
+			int			Int_Comp;
+			char		Str_Comp[31];
+		} var_1;
+		struct {
+			Enumeration E_Comp_2;
+			char		Str_2_Comp[31];
+		} var_2;
+		struct {
+			char Ch_1_Comp;
+			char Ch_2_Comp;
+		} var_3;
+	} variant;
+} Rec_Type, *Rec_Pointer;
+
+/* dhry_1.c globals, in SRAM for both runs, the records static instead of malloc()ed */
+static Rec_Type		  dhry_rec[2];
+static Rec_Pointer	  Ptr_Glob;
+static Rec_Pointer	  Next_Ptr_Glob;
+static int			  Int_Glob;
+static Boolean		  Bool_Glob;
+static char			  Ch_1_Glob;
+static char			  Ch_2_Glob;
+static Arr_1_Dim	  Arr_1_Glob;
+static Arr_2_Dim	  Arr_2_Glob;
+
+/* main()'s locals, kept for the final check */
+static struct {
+	One_Fifty	Int_1_Loc;
+	One_Fifty	Int_2_Loc;
+	One_Fifty	Int_3_Loc;
+	Enumeration Enum_Loc;
+	Str_30		Str_1_Loc;
+	Str_30		Str_2_Loc;
+} dhry_loc;
+
+/* in .data, so the flash and the SRAM run copy them from SRAM alike */
+static char dhry_str_some[] = "DHRYSTONE PROGRAM, SOME STRING";
+static char dhry_str_1st[] = "DHRYSTONE PROGRAM, 1'ST STRING";
+static char dhry_str_2nd[] = "DHRYSTONE PROGRAM, 2'ND STRING";
+static char dhry_str_3rd[] = "DHRYSTONE PROGRAM, 3'RD STRING";
+
+#define DHRY_FN(name) name##_flash
+#define DHRY_TEXT
+#define DHRY_CALL __attribute__((noinline))
+#include "dhry.h"
+#undef DHRY_FN
+#undef DHRY_TEXT
+#undef DHRY_CALL
+
+#define DHRY_FN(name) name##_ram
+#define DHRY_TEXT __attribute__((section(".ramfunc")))
+#define DHRY_CALL RAMFUNC
+#include "dhry.h"
+#undef DHRY_FN
+#undef DHRY_TEXT
+#undef DHRY_CALL
+
+static bool dhry_streq(const char *s1, const char *s2)
+{
+	while (*s1 && *s1 == *s2)
+		s1++, s2++;
+	return *s1 == *s2;
+}
+
+/* dhry_1.c's initialisation ahead of the timed loop */
+static void dhry_init(void)
+{
+	Next_Ptr_Glob = &dhry_rec[0];
+	Ptr_Glob = &dhry_rec[1];
+	Ptr_Glob->Ptr_Comp = Next_Ptr_Glob;
+	Ptr_Glob->Discr = Ident_1;
+	Ptr_Glob->variant.var_1.Enum_Comp = Ident_3;
+	Ptr_Glob->variant.var_1.Int_Comp = 40;
+	dhry_strcpy_flash(Ptr_Glob->variant.var_1.Str_Comp, dhry_str_some);
+	dhry_strcpy_flash(dhry_loc.Str_1_Loc, dhry_str_1st);
+	Arr_2_Glob[8][7] = 10;
+}
+
+/* the values dhry_1.c prints as "should be" after the loop */
+static bool dhry_check(int runs)
+{
+	return Int_Glob == 5 && Bool_Glob == 1 && Ch_1_Glob == 'A' && Ch_2_Glob == 'B' &&
+		   Arr_1_Glob[8] == 7 && Arr_2_Glob[8][7] == runs + 10 &&
+		   Ptr_Glob->Ptr_Comp == Next_Ptr_Glob && Ptr_Glob->Discr == Ident_1 &&
+		   Ptr_Glob->variant.var_1.Enum_Comp == Ident_3 &&
+		   Ptr_Glob->variant.var_1.Int_Comp == 17 &&
+		   dhry_streq(Ptr_Glob->variant.var_1.Str_Comp, dhry_str_some) &&
+		   Next_Ptr_Glob->Ptr_Comp == Next_Ptr_Glob && Next_Ptr_Glob->Discr == Ident_1 &&
+		   Next_Ptr_Glob->variant.var_1.Enum_Comp == Ident_2 &&
+		   Next_Ptr_Glob->variant.var_1.Int_Comp == 18 &&
+		   dhry_streq(Next_Ptr_Glob->variant.var_1.Str_Comp, dhry_str_some) &&
+		   dhry_loc.Int_1_Loc == 5 && dhry_loc.Int_2_Loc == 13 && dhry_loc.Int_3_Loc == 7 &&
+		   dhry_loc.Enum_Loc == Ident_2 && dhry_streq(dhry_loc.Str_1_Loc, dhry_str_1st) &&
+		   dhry_streq(dhry_loc.Str_2_Loc, dhry_str_2nd);
+}
+
+/* returns 0 if the final values check out, the cycles of the loop alone in cycles */
+int cpumark_run(int runs, bool ram, uint32_t *cycles)
+{
+	uint32_t start;
+
+	dhry_init();
+	start = cpu_cycles();
+	if (ram)
+		dhry_loop_ram(runs);
+	else
+		dhry_loop_flash(runs);
+	*cycles = cpu_cycles() - start;
+	return dhry_check(runs) ? 0 : -1;
+}
+
+#endif /* CPUMARK */
@@ -0,0 +1,17 @@
+#ifndef __CPUMARK_H__
+#define __CPUMARK_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Dhrystone 2.1 CPU benchmark, built with CPUMARK=yes. The same code is
+ * built twice, to run from the flash XIP and from SRAM. DMIPS are
+ * Dhrystones per second over 1757, the VAX 11/780 score.
+ */
+#define CPUMARK_RUNS	   2000
+#define CPUMARK_VAX_DHRY_S 1757
+
+int cpumark_run(int runs, bool ram, uint32_t *cycles);
+
+#endif /* __CPUMARK_H__ */
@@ -0,0 +1,225 @@
+/*
+ * Dhrystone 2.1 procedures and main loop (R. P. Weicker, dhry_1.c and
+ * dhry_2.c), in the shape the picorv32 port runs them. No include guard:
+ * cpumark.c includes this twice, DHRY_FN() naming each copy, DHRY_TEXT
+ * placing it and DHRY_CALL also keeping the dhry_2.c procedures out of
+ * line, as separate compilation would.
+ */
+
+static DHRY_CALL void DHRY_FN(dhry_strcpy)(char *d, const char *s)
+{
+	while ((*d++ = *s++) != 0)
+		;
+}
+
+static DHRY_CALL int DHRY_FN(dhry_strcmp)(const char *s1, const char *s2)
+{
+	while (*s1 && *s1 == *s2)
+		s1++, s2++;
+	return *(const unsigned char *)s1 - *(const unsigned char *)s2;
+}
+
+static DHRY_CALL Boolean DHRY_FN(Func_3)(Enumeration Enum_Par_Val)
+{
+	Enumeration Enum_Loc;
+
+	Enum_Loc = Enum_Par_Val;
+	if (Enum_Loc == Ident_3)
+		return true;
+	else
+		return false;
+}
+
+static DHRY_CALL void DHRY_FN(Proc_6)(Enumeration Enum_Val_Par, Enumeration *Enum_Ref_Par)
+{
+	*Enum_Ref_Par = Enum_Val_Par;
+	if (!DHRY_FN(Func_3)(Enum_Val_Par))
+		*Enum_Ref_Par = Ident_4;
+	switch (Enum_Val_Par) {
+	case Ident_1:
+		*Enum_Ref_Par = Ident_1;
+		break;
+	case Ident_2:
+		if (Int_Glob > 100)
+			*Enum_Ref_Par = Ident_1;
+		else
+			*Enum_Ref_Par = Ident_4;
+		break;
+	case Ident_3:
+		*Enum_Ref_Par = Ident_2;
+		break;
+	case Ident_4:
+		break;
+	case Ident_5:
+		*Enum_Ref_Par = Ident_3;
+		break;
+	}
+}
+
+static DHRY_CALL void DHRY_FN(Proc_7)(One_Fifty Int_1_Par_Val, One_Fifty Int_2_Par_Val,
+									  One_Fifty *Int_Par_Ref)
+{
+	One_Fifty Int_Loc;
+
+	Int_Loc = Int_1_Par_Val + 2;
+	*Int_Par_Ref = Int_2_Par_Val + Int_Loc;
+}
+
+static DHRY_CALL void DHRY_FN(Proc_8)(Arr_1_Dim Arr_1_Par_Ref, Arr_2_Dim Arr_2_Par_Ref,
+									  int Int_1_Par_Val, int Int_2_Par_Val)
+{
+	One_Fifty Int_Index;
+	One_Fifty Int_Loc;
+
+	Int_Loc = Int_1_Par_Val + 5;
+	Arr_1_Par_Ref[Int_Loc] = Int_2_Par_Val;
+	Arr_1_Par_Ref[Int_Loc + 1] = Arr_1_Par_Ref[Int_Loc];
+	Arr_1_Par_Ref[Int_Loc + 30] = Int_Loc;
+	for (Int_Index = Int_Loc; Int_Index <= Int_Loc + 1; ++Int_Index)
+		Arr_2_Par_Ref[Int_Loc][Int_Index] = Int_Loc;
+	Arr_2_Par_Ref[Int_Loc][Int_Loc - 1] += 1;
+	Arr_2_Par_Ref[Int_Loc + 20][Int_Loc] = Arr_1_Par_Ref[Int_Loc];
+	Int_Glob = 5;
+}
+
+static DHRY_CALL Enumeration DHRY_FN(Func_1)(Capital_Letter Ch_1_Par_Val,
+											 Capital_Letter Ch_2_Par_Val)
+{
+	Capital_Letter Ch_1_Loc;
+	Capital_Letter Ch_2_Loc;
+
+	Ch_1_Loc = Ch_1_Par_Val;
+	Ch_2_Loc = Ch_1_Loc;
+	if (Ch_2_Loc != Ch_2_Par_Val)
+		return Ident_1;
+	else {
+		Ch_1_Glob = Ch_1_Loc;
+		return Ident_2;
+	}
+}
+
+static DHRY_CALL Boolean DHRY_FN(Func_2)(Str_30 Str_1_Par_Ref, Str_30 Str_2_Par_Ref)
+{
+	One_Thirty	   Int_Loc;
+	Capital_Letter Ch_Loc = 0;
+
+	Int_Loc = 2;
+	while (Int_Loc <= 2)
+		if (DHRY_FN(Func_1)(Str_1_Par_Ref[Int_Loc], Str_2_Par_Ref[Int_Loc + 1]) == Ident_1) {
+			Ch_Loc = 'A';
+			Int_Loc += 1;
+		}
+	if (Ch_Loc >= 'W' && Ch_Loc < 'Z')
+		Int_Loc = 7;
+	if (Ch_Loc == 'R')
+		return true;
+	else {
+		if (DHRY_FN(dhry_strcmp)(Str_1_Par_Ref, Str_2_Par_Ref) > 0) {
+			Int_Loc += 7;
+			Int_Glob = Int_Loc;
+			return true;
+		} else
+			return false;
+	}
+}
+
+static DHRY_TEXT void DHRY_FN(Proc_3)(Rec_Pointer *Ptr_Ref_Par)
+{
+	if (Ptr_Glob != NULL)
+		*Ptr_Ref_Par = Ptr_Glob->Ptr_Comp;
+	DHRY_FN(Proc_7)(10, Int_Glob, &Ptr_Glob->variant.var_1.Int_Comp);
+}
+
+static DHRY_TEXT void DHRY_FN(Proc_1)(Rec_Pointer Ptr_Val_Par)
+{
+	Rec_Pointer Next_Record = Ptr_Val_Par->Ptr_Comp;
+
+	*Ptr_Val_Par->Ptr_Comp = *Ptr_Glob;
+	Ptr_Val_Par->variant.var_1.Int_Comp = 5;
+	Next_Record->variant.var_1.Int_Comp = Ptr_Val_Par->variant.var_1.Int_Comp;
+	Next_Record->Ptr_Comp = Ptr_Val_Par->Ptr_Comp;
+	DHRY_FN(Proc_3)(&Next_Record->Ptr_Comp);
+	if (Next_Record->Discr == Ident_1) {
+		Next_Record->variant.var_1.Int_Comp = 6;
+		DHRY_FN(Proc_6)(Ptr_Val_Par->variant.var_1.Enum_Comp,
+						&Next_Record->variant.var_1.Enum_Comp);
+		Next_Record->Ptr_Comp = Ptr_Glob->Ptr_Comp;
+		DHRY_FN(Proc_7)(Next_Record->variant.var_1.Int_Comp, 10,
+						&Next_Record->variant.var_1.Int_Comp);
+	} else
+		*Ptr_Val_Par = *Ptr_Val_Par->Ptr_Comp;
+}
+
+static DHRY_TEXT void DHRY_FN(Proc_2)(One_Fifty *Int_Par_Ref)
+{
+	One_Fifty	Int_Loc;
+	Enumeration Enum_Loc = Ident_2;
+
+	Int_Loc = *Int_Par_Ref + 10;
+	do
+		if (Ch_1_Glob == 'A') {
+			Int_Loc -= 1;
+			*Int_Par_Ref = Int_Loc - Int_Glob;
+			Enum_Loc = Ident_1;
+		}
+	while (Enum_Loc != Ident_1);
+}
+
+static DHRY_TEXT void DHRY_FN(Proc_4)(void)
+{
+	Boolean Bool_Loc;
+
+	Bool_Loc = Ch_1_Glob == 'A';
+	Bool_Glob = Bool_Loc | Bool_Glob;
+	Ch_2_Glob = 'B';
+}
+
+static DHRY_TEXT void DHRY_FN(Proc_5)(void)
+{
+	Ch_1_Glob = 'A';
+	Bool_Glob = false;
+}
+
+/* the timed part of dhry_1.c main(), its locals left in dhry_loc for the check */
+static DHRY_CALL void DHRY_FN(dhry_loop)(int Number_Of_Runs)
+{
+	One_Fifty	Int_1_Loc = 0;
+	One_Fifty	Int_2_Loc = 0;
+	One_Fifty	Int_3_Loc = 0;
+	char		Ch_Index;
+	Enumeration Enum_Loc = Ident_1;
+	int			Run_Index;
+
+	for (Run_Index = 1; Run_Index <= Number_Of_Runs; ++Run_Index) {
+		DHRY_FN(Proc_5)();
+		DHRY_FN(Proc_4)();
+		Int_1_Loc = 2;
+		Int_2_Loc = 3;
+		DHRY_FN(dhry_strcpy)(dhry_loc.Str_2_Loc, dhry_str_2nd);
+		Enum_Loc = Ident_2;
+		Bool_Glob = !DHRY_FN(Func_2)(dhry_loc.Str_1_Loc, dhry_loc.Str_2_Loc);
+		while (Int_1_Loc < Int_2_Loc) {
+			Int_3_Loc = 5 * Int_1_Loc - Int_2_Loc;
+			DHRY_FN(Proc_7)(Int_1_Loc, Int_2_Loc, &Int_3_Loc);
+			Int_1_Loc += 1;
+		}
+		DHRY_FN(Proc_8)(Arr_1_Glob, Arr_2_Glob, Int_1_Loc, Int_3_Loc);
+		DHRY_FN(Proc_1)(Ptr_Glob);
+		for (Ch_Index = 'A'; Ch_Index <= Ch_2_Glob; ++Ch_Index) {
+			if (Enum_Loc == DHRY_FN(Func_1)(Ch_Index, 'C')) {
+				DHRY_FN(Proc_6)(Ident_1, &Enum_Loc);
+				DHRY_FN(dhry_strcpy)(dhry_loc.Str_2_Loc, dhry_str_3rd);
+				Int_2_Loc = Run_Index;
+				Int_Glob = Run_Index;
+			}
+		}
+		Int_2_Loc = Int_2_Loc * Int_1_Loc;
+		Int_1_Loc = Int_2_Loc / Int_3_Loc;
+		Int_2_Loc = 7 * (Int_2_Loc - Int_3_Loc) - Int_1_Loc;
+		DHRY_FN(Proc_2)(&Int_1_Loc);
+	}
+	dhry_loc.Int_1_Loc = Int_1_Loc;
+	dhry_loc.Int_2_Loc = Int_2_Loc;
+	dhry_loc.Int_3_Loc = Int_3_Loc;
+	dhry_loc.Enum_Loc = Enum_Loc;
+}
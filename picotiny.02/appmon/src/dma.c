@@ -0,0 +1,112 @@
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hwdefs.h"
+#include "dma.h"
+
+bool dma_available(void)
+{
+	return dma_regs->id == DMA_ID;
+}
+
+uint32_t dma_status(void)
+{
+	return dma_regs->ctrl;
+}
+
+/* the chain must stay put until the engine is done with it */
+void dma_start(const DMA_DESC *chain, bool irq)
+{
+	dma_regs->desc = (uint32_t)chain;
+	dma_regs->ctrl = DMA_CTRL_START | (irq ? DMA_CTRL_IRQEN : 0);
+}
+
+/*
+ * returns the poll count, -1 on a timeout or a bad descriptor. A chain
+ * that times out is aborted and has stopped on return, so the caller may
+ * redo the move without the engine still writing behind it.
+ */
+int dma_wait(void)
+{
+	int waitcount = 0;
+
+	while (waitcount++ < DMA_WAIT_MAXCOUNT && (dma_regs->ctrl & DMA_STAT_BUSY))
+		;
+	if (dma_regs->ctrl & DMA_STAT_BUSY) {
+		dma_regs->ctrl = DMA_CTRL_ABORT;
+		while (dma_regs->ctrl & DMA_STAT_BUSY)
+			;
+		return -1;
+	}
+	if (dma_regs->ctrl & DMA_STAT_ERROR)
+		return -1;
+	return waitcount;
+}
+
+int dma_run(const DMA_DESC *chain)
+{
+	if (!dma_available() || (dma_regs->ctrl & DMA_STAT_BUSY))
+		return -1;
+	dma_start(chain, false);
+	return dma_wait();
+}
+
+/*
+ * Copies n bytes, all three a multiple of 4, as DMA_LINE_MAX byte lines
+ * and the rest. A forward copy, so dst may only overlap src below it.
+ */
+int dma_copy(uint32_t dst, uint32_t src, uint32_t n)
+{
+	DMA_DESC d[2];
+	uint32_t lines = n / DMA_LINE_MAX;
+	uint32_t rest = n % DMA_LINE_MAX;
+
+	if (((dst | src | n) & 3) || lines > 0xffff)
+		return -1;
+	if (n == 0)
+		return 0;
+	d[0].src = src;
+	d[0].dst = dst;
+	d[0].size = DMA_SIZE(lines ? DMA_LINE_MAX : 0, lines);
+	d[0].stride = DMA_STRIDE(DMA_LINE_MAX, DMA_LINE_MAX);
+	d[0].next = rest ? (uint32_t)&d[1] : 0;
+	d[1].src = src + lines * DMA_LINE_MAX;
+	d[1].dst = dst + lines * DMA_LINE_MAX;
+	d[1].size = DMA_SIZE(rest, 1);
+	d[1].stride = 0;
+	d[1].next = 0;
+	return dma_run(lines ? &d[0] : &d[1]);
+}
+
+/*
+ * Fills n bytes at dst with word, dst and n a multiple of DMA_FILL_LINE:
+ * one SRAM line of it goes out again and again at a source stride of 0.
+ */
+int dma_fill(uint32_t dst, uint32_t word, uint32_t n)
+{
+	static uint32_t line[DMA_FILL_LINE / 4];
+	DMA_DESC		d;
+	int				waitcount = 0;
+
+	if ((dst | n) & (DMA_FILL_LINE - 1))
+		return -1;
+	for (int i = 0; i < DMA_FILL_LINE / 4; i++)
+		line[i] = word;
+	while (n) {
+		uint32_t lines = n / DMA_FILL_LINE;
+		if (lines > 0xffff)
+			lines = 0xffff;
+		d.src = (uint32_t)line;
+		d.dst = dst;
+		d.size = DMA_SIZE(DMA_FILL_LINE, lines);
+		d.stride = DMA_STRIDE(0, DMA_FILL_LINE);
+		d.next = 0;
+		int w = dma_run(&d);
+		if (w < 0)
+			return -1;
+		waitcount += w;
+		dst += lines * DMA_FILL_LINE;
+		n -= lines * DMA_FILL_LINE;
+	}
+	return waitcount;
+}
@@ -0,0 +1,20 @@
+#ifndef __DMA_H__
+#define __DMA_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hwdefs.h"
+
+#define DMA_WAIT_MAXCOUNT 1000000
+#define DMA_FILL_LINE	  32 /* a PSRAM block */
+
+bool	 dma_available(void);
+void	 dma_start(const DMA_DESC *chain, bool irq);
+int		 dma_wait(void);
+int		 dma_run(const DMA_DESC *chain);
+int		 dma_copy(uint32_t dst, uint32_t src, uint32_t n);
+int		 dma_fill(uint32_t dst, uint32_t word, uint32_t n);
+uint32_t dma_status(void);
+
+#endif /* __DMA_H__ */
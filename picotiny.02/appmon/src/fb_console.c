@@ -0,0 +1,527 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "hwdefs.h"
+#include "sysutils.h"
+#include "fbfont.h"
+#include "fb_graphics.h"
+#include "fb_glyphcache.h"
+#include "fb_console.h"
+
+#define DIRTY_NONE 0xff
+
+/* cell = char | attr << 8, attr = fg | bg << 4 (palette indices) */
+#define CELL(ch, attr)	((ch) | ((attr) << 8))
+#define ATTR_FG(attr)	((attr) & 0x0f)
+#define ATTR_BG(attr)	((attr) >> 4)
+#define ATTR_DEFAULT	0x07
+#define BOLD			0x08
+
+// clang-format off
+/* VGA text mode colors, the usual ANSI terminal palette */
+static const uint32_t fbcon_palette[16] = {
+	0x000000, 0xAA0000, 0x00AA00, 0xAA5500, 0x0000AA, 0xAA00AA, 0x00AAAA, 0xAAAAAA,
+	0x555555, 0xFF5555, 0x55FF55, 0xFFFF55, 0x5555FF, 0xFF55FF, 0x55FFFF, 0xFFFFFF,
+};
+// clang-format on
+
+enum { ST_TEXT, ST_ESC, ST_CSI };
+
+static bool		con_enabled = false;
+static bool		con_shown = false;
+static bool		con_hw = false; /* hardware text layer backend */
+/* dispaddr shows the console surface, gfx_dispaddr goes back when it hides */
+static bool		con_on_surface = false;
+static uint32_t gfx_dispaddr = LCD_FBADDR;
+static int		con_font;
+static int		cell_w, cell_h;
+static int		cols, rows;
+static uint32_t top_line; /* history line shown on screen row 0 */
+static int		view_y;	  /* surface line shown on LCD line 0 */
+static int		back;	  /* scrollback offset in lines, 0 is live */
+static int		cur_row, cur_col;
+static uint8_t	attr = ATTR_DEFAULT;
+static bool		bold;
+static bool		cursor_on = true;
+static int		drawn_row = -1, drawn_col;
+static uint8_t	dmin[FBCON_MAX_ROWS], dmax[FBCON_MAX_ROWS];
+
+static int esc_state = ST_TEXT;
+static int esc_params[4];
+static int esc_nparams;
+static bool esc_private;
+
+FBCON_STATS fbcon_stats;
+
+static inline volatile uint16_t *text_line(uint32_t line)
+{
+	return (volatile uint16_t *)(FBCON_TEXT_ADDR +
+								 (line % FBCON_HISTORY) * FBCON_MAX_COLS * sizeof(uint16_t));
+}
+
+static inline uint32_t view_addr(void)
+{
+	return FBCON_SURFACE_ADDR + view_y * FBCON_STRIDE;
+}
+
+static void update_dispaddr(void)
+{
+	if (con_shown && !con_hw)
+		lcd_regs->dispaddr = view_addr();
+}
+
+/* text layer over the framebuffer, background color 0 is see-through */
+static void update_txtctrl(void)
+{
+	if (con_shown && con_hw)
+		lcd_regs->txtctrl = TXTCTRL_ENABLE | TXTCTRL_TRANSPARENT |
+							(cursor_on ? TXTCTRL_CURSOR | TXTCTRL_BLINK : 0);
+	else
+		lcd_regs->txtctrl = 0;
+}
+
+/* text layer cell row of a screen row */
+static inline int hw_row(int row)
+{
+	return (top_line + row) % TXT_ROWS;
+}
+
+static inline void mark_dirty(int row, int c0, int c1)
+{
+	if (dmin[row] == DIRTY_NONE || c0 < dmin[row])
+		dmin[row] = c0;
+	if (dmax[row] == DIRTY_NONE || c1 > dmax[row])
+		dmax[row] = c1;
+}
+
+static inline void mark_all_dirty(void)
+{
+	for (int r = 0; r < rows; r++) {
+		dmin[r] = 0;
+		dmax[r] = cols - 1;
+	}
+}
+
+/* blanks cells c0..c1 of a screen row, whole rows are cleared by the GPU */
+static void erase_cells(int row, int c0, int c1)
+{
+	volatile uint16_t *line = text_line(top_line + row);
+	uint16_t		   blank = CELL(' ', attr & 0xf0);
+
+	for (int c = c0; c <= c1; c++)
+		line[c] = blank;
+	if (c0 == 0 && c1 == cols - 1 && back == 0 && !con_hw) {
+		gpu_fill_rect(view_addr(), 0, row * cell_h, cols * cell_w, cell_h,
+					  fbcon_palette[ATTR_BG(attr)]);
+		dmin[row] = dmax[row] = DIRTY_NONE;
+		if (row == drawn_row)
+			drawn_row = -1;
+	}
+	else
+		mark_dirty(row, c0, c1);
+}
+
+static void scroll_up(void)
+{
+	top_line++;
+	fbcon_stats.scrolls++;
+	memmove(dmin, dmin + 1, rows - 1);
+	memmove(dmax, dmax + 1, rows - 1);
+	if (drawn_row >= 0)
+		drawn_row--;
+
+	if (back == 0 && con_hw)
+		lcd_regs->txtscroll = hw_row(0);
+	else if (back == 0) {
+		if (view_y + cell_h + LCD_HEIGHT > FBCON_SURFACE_LINES) {
+			/* copy rows 1..rows-1 back to the top, once every few screens */
+			fb_copy_rect(view_addr() + cell_h * FBCON_STRIDE, 0, 0,
+						 FBCON_SURFACE_ADDR, 0, 0, LCD_WIDTH, (rows - 1) * cell_h);
+			view_y = 0;
+			fbcon_stats.wraps++;
+		}
+		else
+			view_y += cell_h;
+		/* the margin below the last row is shown too, keep it blank */
+		gpu_fill_rect(view_addr(), 0, rows * cell_h, LCD_WIDTH,
+					  LCD_HEIGHT - rows * cell_h, fbcon_palette[0]);
+		update_dispaddr();
+	}
+	dmin[rows - 1] = dmax[rows - 1] = DIRTY_NONE;
+	erase_cells(rows - 1, 0, cols - 1);
+}
+
+static void line_feed(void)
+{
+	if (cur_row < rows - 1)
+		cur_row++;
+	else
+		scroll_up();
+}
+
+static void put_text(int c)
+{
+	if (cur_col >= cols) {
+		/* deferred auto-wrap like a VT100 */
+		cur_col = 0;
+		line_feed();
+	}
+	text_line(top_line + cur_row)[cur_col] = CELL(c, attr);
+	mark_dirty(cur_row, cur_col, cur_col);
+	cur_col++;
+}
+
+static void set_sgr(int p)
+{
+	if (p == 0) {
+		attr = ATTR_DEFAULT;
+		bold = false;
+	}
+	else if (p == 1) {
+		bold = true;
+		attr |= BOLD;
+	}
+	else if (p == 22) {
+		bold = false;
+		attr &= ~BOLD;
+	}
+	else if (p >= 30 && p <= 37)
+		attr = (attr & 0xf0) | (p - 30) | (bold ? BOLD : 0);
+	else if (p == 39)
+		attr = (attr & 0xf0) | (ATTR_DEFAULT & 0x0f) | (bold ? BOLD : 0);
+	else if (p >= 40 && p <= 47)
+		attr = (attr & 0x0f) | ((p - 40) << 4);
+	else if (p == 49)
+		attr = (attr & 0x0f) | (ATTR_DEFAULT & 0xf0);
+	else if (p >= 90 && p <= 97)
+		attr = (attr & 0xf0) | (p - 90 + 8);
+	else if (p >= 100 && p <= 107)
+		attr = (attr & 0x0f) | ((p - 100 + 8) << 4);
+}
+
+/* executes a CSI sequence, the subset the CLI and simple tools emit */
+static void do_csi(int final)
+{
+	int p0 = esc_nparams > 0 ? esc_params[0] : 0;
+	int n = p0 > 0 ? p0 : 1;
+
+	if (esc_private) {
+		if (p0 == 25 && (final == 'h' || final == 'l')) {
+			cursor_on = (final == 'h');
+			if (con_hw)
+				update_txtctrl();
+			if (drawn_row >= 0)
+				mark_dirty(drawn_row, drawn_col, drawn_col);
+			drawn_row = -1;
+		}
+		return;
+	}
+
+	switch (final) {
+	case 'A':
+		cur_row = MAX(cur_row - n, 0);
+		break;
+	case 'B':
+		cur_row = MIN(cur_row + n, rows - 1);
+		break;
+	case 'C':
+		cur_col = MIN(cur_col + n, cols - 1);
+		break;
+	case 'D':
+		cur_col = MAX(MIN(cur_col, cols - 1) - n, 0);
+		break;
+	case 'H':
+	case 'f':
+		cur_row = BOUND(1, esc_nparams > 0 ? esc_params[0] : 1, rows) - 1;
+		cur_col = BOUND(1, esc_nparams > 1 ? esc_params[1] : 1, cols) - 1;
+		break;
+	case 'J':
+		if (p0 == 0) {
+			if (cur_col < cols)
+				erase_cells(cur_row, MIN(cur_col, cols - 1), cols - 1);
+			for (int r = cur_row + 1; r < rows; r++)
+				erase_cells(r, 0, cols - 1);
+		}
+		else if (p0 == 1) {
+			for (int r = 0; r < cur_row; r++)
+				erase_cells(r, 0, cols - 1);
+			erase_cells(cur_row, 0, MIN(cur_col, cols - 1));
+		}
+		else {
+			for (int r = 0; r < rows; r++)
+				erase_cells(r, 0, cols - 1);
+		}
+		break;
+	case 'K':
+		if (p0 == 0)
+			erase_cells(cur_row, MIN(cur_col, cols - 1), cols - 1);
+		else if (p0 == 1)
+			erase_cells(cur_row, 0, MIN(cur_col, cols - 1));
+		else
+			erase_cells(cur_row, 0, cols - 1);
+		break;
+	case 'm':
+		if (esc_nparams == 0)
+			set_sgr(0);
+		for (int i = 0; i < esc_nparams; i++)
+			set_sgr(esc_params[i]);
+		break;
+	}
+}
+
+static void con_putc(int c)
+{
+	switch (esc_state) {
+	case ST_ESC:
+		if (c == '[') {
+			esc_state = ST_CSI;
+			esc_nparams = 0;
+			esc_private = false;
+			memset(esc_params, 0, sizeof(esc_params));
+		}
+		else
+			esc_state = ST_TEXT;
+		return;
+	case ST_CSI:
+		if (c >= '0' && c <= '9') {
+			if (esc_nparams == 0)
+				esc_nparams = 1;
+			if (esc_nparams <= ARRAY_SIZE(esc_params))
+				esc_params[esc_nparams - 1] = esc_params[esc_nparams - 1] * 10 + c - '0';
+		}
+		else if (c == ';') {
+			if (esc_nparams == 0)
+				esc_nparams = 1;
+			esc_nparams++;
+		}
+		else if (c == '?')
+			esc_private = true;
+		else if (c >= 0x40 && c <= 0x7e) {
+			esc_nparams = MIN(esc_nparams, (int)ARRAY_SIZE(esc_params));
+			do_csi(c);
+			esc_state = ST_TEXT;
+		}
+		return;
+	}
+
+	switch (c) {
+	case '\e':
+		esc_state = ST_ESC;
+		break;
+	case '\n':
+		/* stdout is not translated, follow __io_putchar and do CR+LF */
+		cur_col = 0;
+		line_feed();
+		break;
+	case '\r':
+		cur_col = 0;
+		break;
+	case '\b':
+		if (cur_col > 0)
+			cur_col = MIN(cur_col, cols) - 1;
+		break;
+	case '\t':
+		do
+			put_text(' ');
+		while (cur_col < cols && (cur_col & 7));
+		break;
+	default:
+		if (c >= ' ' && c < 0x7f)
+			put_text(c);
+		break;
+	}
+}
+
+/* renders cells c0..c1 of a screen row from history line */
+static void draw_cells(int row, uint32_t line, int c0, int c1)
+{
+	volatile uint16_t *cells = text_line(line);
+	uint32_t		   vaddr = view_addr();
+	int				   y = row * cell_h;
+	int				   x = c0 * cell_w;
+
+	if (con_hw) {
+		volatile uint32_t *hw = TXT_CELL(0, hw_row(row));
+		for (int c = c0; c <= c1; c++)
+			hw[c] = cells[c];
+		fbcon_stats.rows_drawn++;
+		fbcon_stats.cells_drawn += c1 - c0 + 1;
+		return;
+	}
+	for (int c = c0; c <= c1; c++, x += cell_w) {
+		uint16_t cell = cells[c];
+		uint8_t	 a = cell >> 8;
+		uint32_t fg = fbcon_palette[ATTR_FG(a)];
+		uint32_t bg = fbcon_palette[ATTR_BG(a)];
+		int		 ch = cell & 0xff;
+
+		if (cursor_on && back == 0 && row == cur_row && c == cur_col) {
+			uint32_t t = fg;
+			fg = bg;
+			bg = t;
+		}
+		int next = gcache_putc(vaddr, x, y, con_font, ch, fg, bg);
+		/* proportional fonts leave part of the cell */
+		if (next < x + cell_w)
+			gpu_fill_rect(vaddr, next, y, x + cell_w - next, cell_h, bg);
+	}
+	fbcon_stats.rows_drawn++;
+	fbcon_stats.cells_drawn += c1 - c0 + 1;
+}
+
+/* redraws the dirty spans of all rows in one pass */
+void fbcon_flush(void)
+{
+	uint32_t start_msec = systime_msec();
+	int		 col = MIN(cur_col, cols - 1);
+
+	/* while the scrollback is shown only the history is updated */
+	if (!con_enabled || back)
+		return;
+
+	if (con_hw)
+		lcd_regs->txtcursor = col | (hw_row(cur_row) << 16);
+	/* the cursor is drawn inverted, redraw the cell it left */
+	else if (drawn_row >= 0 && (drawn_row != cur_row || drawn_col != col))
+		mark_dirty(drawn_row, drawn_col, drawn_col);
+	if (cursor_on && !con_hw) {
+		mark_dirty(cur_row, col, col);
+		drawn_row = cur_row;
+		drawn_col = col;
+	}
+
+	for (int r = 0; r < rows; r++) {
+		if (dmin[r] == DIRTY_NONE)
+			continue;
+		draw_cells(r, top_line + r, dmin[r], dmax[r]);
+		dmin[r] = dmax[r] = DIRTY_NONE;
+	}
+	fbcon_stats.flush_msecs += systime_msec() - start_msec;
+}
+
+void fbcon_write(const char *buf, int len)
+{
+	if (!con_enabled)
+		return;
+	for (int i = 0; i < len; i++)
+		con_putc(buf[i]);
+	fbcon_stats.chars += len;
+	fbcon_flush();
+}
+
+/*
+ * Shows the screen as it was lines back in the history, output meanwhile
+ * only goes to the history. 0 returns to the live screen, which is then
+ * redrawn once. Returns the offset actually used.
+ */
+int fbcon_scrollback(int lines)
+{
+	int maxback = MIN(top_line, FBCON_HISTORY - rows);
+
+	if (!con_enabled)
+		return 0;
+	back = BOUND(0, lines, maxback);
+	drawn_row = -1;
+	if (back) {
+		for (int r = 0; r < rows; r++)
+			draw_cells(r, top_line - back + r, 0, cols - 1);
+	}
+	else {
+		mark_all_dirty();
+		fbcon_flush();
+	}
+	return back;
+}
+
+/* fontnum is a blit-ready font or FBCON_HWTEXT for the hardware text layer */
+int fbcon_init(int fontnum)
+{
+	if (fontnum == FBCON_HWTEXT) {
+		if ((*GPU_CAPS & GPU_CAP_TEXT) == 0)
+			return -1;
+		con_hw = true;
+		cell_w = TXT_CELL_W;
+		cell_h = TXT_CELL_H;
+		cols = TXT_COLS;
+		rows = TXT_ROWS;
+	}
+	else {
+		const uint8_t	 *font = fb_font(fontnum);
+		const FBFONT_HDR *hdr = fbfont_hdr(font);
+
+		con_hw = false;
+		con_font = fontnum;
+		cell_w = 0;
+		for (int i = 0; i < hdr->char_count; i++)
+			cell_w = MAX(cell_w, (int)fbfont_glyphs(font)[i].advance);
+		cell_h = hdr->height;
+		cols = MIN(LCD_WIDTH / cell_w, FBCON_MAX_COLS);
+		rows = MIN(LCD_HEIGHT / cell_h, FBCON_MAX_ROWS);
+	}
+
+	top_line = 0;
+	view_y = 0;
+	back = 0;
+	cur_row = cur_col = 0;
+	attr = ATTR_DEFAULT;
+	bold = false;
+	cursor_on = true;
+	drawn_row = -1;
+	esc_state = ST_TEXT;
+	memset(dmin, DIRTY_NONE, sizeof(dmin));
+	memset(dmax, DIRTY_NONE, sizeof(dmax));
+	memset(&fbcon_stats, 0, sizeof(fbcon_stats));
+
+	con_enabled = true;
+	if (con_hw)
+		lcd_regs->txtscroll = 0;
+	else
+		gpu_fill_rect(view_addr(), 0, rows * cell_h, LCD_WIDTH, LCD_HEIGHT - rows * cell_h,
+					  fbcon_palette[0]);
+	for (int r = 0; r < rows; r++)
+		erase_cells(r, 0, cols - 1);
+	fbcon_show(con_shown);
+	fbcon_flush();
+	return 0;
+}
+
+/* stops mirroring stdout, the history and surface are kept */
+void fbcon_enable(bool on)
+{
+	con_enabled = on;
+}
+
+/*
+ * Puts the console on the LCD: its own surface, or the text layer over the
+ * graphics framebuffer. Off shows the graphics framebuffer alone.
+ */
+void fbcon_show(bool on)
+{
+	con_shown = on;
+	if (on && !con_hw) {
+		/* remember the page shown, a page flip included */
+		if (!con_on_surface)
+			gfx_dispaddr = lcd_regs->dispaddr;
+		con_on_surface = true;
+		update_dispaddr();
+	}
+	else if (con_on_surface) {
+		lcd_regs->dispaddr = gfx_dispaddr;
+		con_on_surface = false;
+	}
+	if (*GPU_CAPS & GPU_CAP_TEXT)
+		update_txtctrl();
+}
+
+bool fbcon_shown(void)
+{
+	return con_shown;
+}
+
+void fbcon_geometry(int *cols_p, int *rows_p, uint32_t *viewaddr_p)
+{
+	*cols_p = cols;
+	*rows_p = rows;
+	*viewaddr_p = view_addr();
+}
@@ -0,0 +1,52 @@
+#ifndef __FB_CONSOLE_H__
+#define __FB_CONSOLE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hwdefs.h"
+#include "fb_glyphcache.h"
+
+/*
+ * Framebuffer text console. Text and attributes live in a ring of
+ * FBCON_HISTORY lines in PSRAM (the scrollback), the pixels in a surface
+ * twice the screen height. Scrolling moves the display address down by one
+ * text row inside that surface and only clears the new row; when the view
+ * reaches the end of the surface the visible rows are copied back to its
+ * top once.
+ *
+ * With FBCON_HWTEXT as font the console drives the hardware text layer
+ * instead: history line n is cell row n % TXT_ROWS, scrolling is a write
+ * of the scroll register and every character a single cell store.
+ */
+#define FBCON_MAX_COLS		128
+#define FBCON_MAX_ROWS		64
+#define FBCON_HISTORY		1024 /* power of 2 */
+#define FBCON_STRIDE		(LCD_WIDTH * LCD_PIXELBYTES)
+#define FBCON_SURFACE_ADDR	(GCACHE_ATLAS_ADDR + GCACHE_ATLAS_LINES * FBCON_STRIDE)
+#define FBCON_SURFACE_LINES (2 * LCD_HEIGHT)
+#define FBCON_TEXT_ADDR		(FBCON_SURFACE_ADDR + FBCON_SURFACE_LINES * FBCON_STRIDE)
+#define FBCON_TEXT_END		(FBCON_TEXT_ADDR + FBCON_HISTORY * FBCON_MAX_COLS * sizeof(uint16_t))
+#define FBCON_HWTEXT		(-1) /* fontnum selecting the hardware text layer */
+
+typedef struct {
+	uint32_t chars;
+	uint32_t scrolls;
+	uint32_t wraps; /* view copied back to the surface top */
+	uint32_t rows_drawn;
+	uint32_t cells_drawn;
+	uint32_t flush_msecs;
+} FBCON_STATS;
+
+extern FBCON_STATS fbcon_stats;
+
+int	 fbcon_init(int fontnum);
+void fbcon_enable(bool on);
+void fbcon_show(bool on);
+bool fbcon_shown(void);
+void fbcon_write(const char *buf, int len);
+void fbcon_flush(void);
+int	 fbcon_scrollback(int lines);
+void fbcon_geometry(int *cols, int *rows, uint32_t *viewaddr);
+
+#endif /* __FB_CONSOLE_H__ */
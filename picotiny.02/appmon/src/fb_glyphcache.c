@@ -0,0 +1,196 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "hwdefs.h"
+#include "fbfont.h"
+#include "fb_graphics.h"
+#include "fb_glyphcache.h"
+
+#define GCACHE_NONE 0xff
+
+/*
+ * One entry per atlas slot (the slot number is the entry index), kept on a
+ * doubly-linked LRU list and a hash chain. The whole table lives in SRAM,
+ * only the rendered pixels are in PSRAM.
+ */
+typedef struct {
+	uint32_t colors; /* fg565 | bg565 << 16 */
+	uint16_t glyph;	 /* char | fontnum << 8 */
+	uint8_t	 width;	 /* cell width (glyph advance) */
+	uint8_t	 height;
+	uint8_t	 prev, next; /* LRU list, head is most recently used */
+	uint8_t	 hnext;		 /* hash chain */
+	uint8_t	 used;
+} GCACHE_ENTRY;
+
+static GCACHE_ENTRY gc_entry[GCACHE_SLOTS];
+static uint8_t		gc_bucket[GCACHE_BUCKETS];
+static uint8_t		gc_head, gc_tail;
+static bool			gc_use_gpu = true;
+
+GCACHE_STATS gcache_stats;
+
+static inline unsigned gc_hash(uint16_t glyph, uint32_t colors)
+{
+	uint32_t h = glyph * 0x9E3779B1u ^ colors;
+	return (h ^ (h >> 16) ^ (h >> 8)) % GCACHE_BUCKETS;
+}
+
+static inline int slot_x(int slot)
+{
+	return (slot % GCACHE_SLOTS_PER_ROW) * GCACHE_SLOT_W;
+}
+
+static inline int slot_y(int slot)
+{
+	return (slot / GCACHE_SLOTS_PER_ROW) * GCACHE_SLOT_H;
+}
+
+static void lru_unlink(int i)
+{
+	GCACHE_ENTRY *e = &gc_entry[i];
+	if (e->prev != GCACHE_NONE)
+		gc_entry[e->prev].next = e->next;
+	else
+		gc_head = e->next;
+	if (e->next != GCACHE_NONE)
+		gc_entry[e->next].prev = e->prev;
+	else
+		gc_tail = e->prev;
+}
+
+static void lru_push_head(int i)
+{
+	GCACHE_ENTRY *e = &gc_entry[i];
+	e->prev = GCACHE_NONE;
+	e->next = gc_head;
+	if (gc_head != GCACHE_NONE)
+		gc_entry[gc_head].prev = i;
+	gc_head = i;
+	if (gc_tail == GCACHE_NONE)
+		gc_tail = i;
+}
+
+static void hash_remove(int i)
+{
+	GCACHE_ENTRY *e = &gc_entry[i];
+	uint8_t		 *pp = &gc_bucket[gc_hash(e->glyph, e->colors)];
+	while (*pp != GCACHE_NONE) {
+		if (*pp == i) {
+			*pp = e->hnext;
+			return;
+		}
+		pp = &gc_entry[*pp].hnext;
+	}
+}
+
+void gcache_flush(void)
+{
+	memset(gc_bucket, GCACHE_NONE, sizeof(gc_bucket));
+	gc_head = gc_tail = GCACHE_NONE;
+	for (int i = 0; i < GCACHE_SLOTS; i++) {
+		gc_entry[i].used = 0;
+		gc_entry[i].hnext = GCACHE_NONE;
+		lru_push_head(i);
+	}
+}
+
+void gcache_init(void)
+{
+	memset(&gcache_stats, 0, sizeof(gcache_stats));
+	gcache_flush();
+}
+
+void gcache_use_gpu(bool on)
+{
+	gc_use_gpu = on;
+}
+
+/* blit a cached cell, clipped to the screen */
+static void gc_copy(int slot, uint32_t fbaddr, int x, int y)
+{
+	GCACHE_ENTRY *e = &gc_entry[slot];
+	int			  w = e->width, h = e->height;
+
+	if (x + w > LCD_WIDTH)
+		w = LCD_WIDTH - x;
+	if (y + h > LCD_HEIGHT)
+		h = LCD_HEIGHT - y;
+	if (w <= 0 || h <= 0)
+		return;
+	if (gc_use_gpu && (*GPU_CAPS & GPU_CAP_BLIT)) {
+		gpu_blit(GCACHE_ATLAS_ADDR, slot_x(slot), slot_y(slot), fbaddr, x, y, w, h);
+		gcache_stats.gpu_blits++;
+	}
+	else {
+		fb_copy_rect_cpu(GCACHE_ATLAS_ADDR, slot_x(slot), slot_y(slot), fbaddr, x, y, w, h);
+		gcache_stats.cpu_copies++;
+	}
+}
+
+/*
+ * Draws c opaque at (x, y) on the surface at fbaddr, rasterizing it into
+ * the atlas first if this (font, char, fg, bg) is not cached yet. Returns
+ * the x position of the next character.
+ */
+int gcache_putc(uint32_t fbaddr, int x, int y, int fontnum, int c,
+				uint32_t fg_argb, uint32_t bg_argb)
+{
+	const uint8_t	   *font = fb_font(fontnum);
+	const FBFONT_GLYPH *g = fbfont_glyph(font, c);
+	uint16_t			glyph = (c & 0xff) | (fontnum << 8);
+	uint32_t			colors = argb2rgb565(fg_argb) | (argb2rgb565(bg_argb) << 16);
+	unsigned			b = gc_hash(glyph, colors);
+
+	if (g == NULL)
+		return x;
+	/* off the top or left edge: skipped like fb_draw_glyph, still advancing */
+	if (x < 0 || y < 0)
+		return x + g->advance;
+
+	for (uint8_t i = gc_bucket[b]; i != GCACHE_NONE; i = gc_entry[i].hnext) {
+		if (gc_entry[i].glyph == glyph && gc_entry[i].colors == colors) {
+			gcache_stats.hits++;
+			lru_unlink(i);
+			lru_push_head(i);
+			gc_copy(i, fbaddr, x, y);
+			return x + g->advance;
+		}
+	}
+
+	gcache_stats.misses++;
+	if (g->advance > GCACHE_SLOT_W || fbfont_hdr(font)->height > GCACHE_SLOT_H) {
+		gcache_stats.bypassed++;
+		return fb_draw_glyph(fbaddr, x, y, fontnum, c, fg_argb, bg_argb);
+	}
+
+	/* recycle the least recently used slot */
+	int			  i = gc_tail;
+	GCACHE_ENTRY *e = &gc_entry[i];
+	if (e->used) {
+		gcache_stats.evictions++;
+		hash_remove(i);
+	}
+	lru_unlink(i);
+	lru_push_head(i);
+	e->used = 1;
+	e->glyph = glyph;
+	e->colors = colors;
+	e->width = g->advance;
+	e->height = fbfont_hdr(font)->height;
+	e->hnext = gc_bucket[b];
+	gc_bucket[b] = i;
+
+	fb_draw_glyph(GCACHE_ATLAS_ADDR, slot_x(i), slot_y(i), fontnum, c, fg_argb, bg_argb);
+	gc_copy(i, fbaddr, x, y);
+	return x + g->advance;
+}
+
+int gcache_puts(uint32_t fbaddr, int x, int y, int fontnum, const char *str,
+				uint32_t fg_argb, uint32_t bg_argb)
+{
+	for (; *str; str++)
+		x = gcache_putc(fbaddr, x, y, fontnum, *str, fg_argb, bg_argb);
+	return x;
+}
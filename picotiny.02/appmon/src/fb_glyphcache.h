@@ -0,0 +1,42 @@
+#ifndef __FB_GLYPHCACHE_H__
+#define __FB_GLYPHCACHE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hwdefs.h"
+
+/*
+ * Rendered glyphs are kept in an RGB565 atlas surface in spare PSRAM, laid
+ * out with the framebuffer line stride so the GPU blit can copy from it.
+ * Each slot holds one glyph cell of up to GCACHE_SLOT_W x GCACHE_SLOT_H.
+ */
+#define GCACHE_SLOTS		 64
+#define GCACHE_SLOT_W		 32
+#define GCACHE_SLOT_H		 32
+#define GCACHE_SLOTS_PER_ROW (LCD_WIDTH / GCACHE_SLOT_W)
+#define GCACHE_BUCKETS		 32
+#define GCACHE_ATLAS_ADDR	 LCD_SPAREADDR
+#define GCACHE_ATLAS_LINES \
+	(((GCACHE_SLOTS + GCACHE_SLOTS_PER_ROW - 1) / GCACHE_SLOTS_PER_ROW) * GCACHE_SLOT_H)
+
+typedef struct {
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t evictions;
+	uint32_t bypassed; /* glyphs too big for a slot */
+	uint32_t gpu_blits;
+	uint32_t cpu_copies;
+} GCACHE_STATS;
+
+extern GCACHE_STATS gcache_stats;
+
+void gcache_init(void);
+void gcache_flush(void);
+void gcache_use_gpu(bool on);
+int	 gcache_putc(uint32_t fbaddr, int x, int y, int fontnum, int c,
+				 uint32_t fg_argb, uint32_t bg_argb);
+int	 gcache_puts(uint32_t fbaddr, int x, int y, int fontnum, const char *str,
+				 uint32_t fg_argb, uint32_t bg_argb);
+
+#endif /* __FB_GLYPHCACHE_H__ */
@@ -9,12 +9,30 @@
 #include "cli.h"
 #include "sysutils.h"
 #include "fb_graphics.h"
+#include "fb_glyphcache.h"
+#include "fb_console.h"
+#include "fb_sprite.h"
 #include "allFonts.h"
+#include "fbfont.h"
+#include "fbf_fixed_bold10x15.h"
+#include "fbf_callibri15.h"
+#include "fbf_callibri22aa.h"
 
 // uint32_t fgcolor_argb = 0xffffffff;
 int init_gui()
 {
 	fb_setcolor(0xFFFFFF);
+	gcache_init();
+	/*
+	 * the hardware text layer over the graphics when the bitstream has one,
+	 * else a console surface that stays hidden until "con -c"
+	 */
+	bool hwtext = fbcon_init(FBCON_HWTEXT) == 0;
+	if (!hwtext)
+		fbcon_init(0);
+	if (sprite_available())
+		sprite_set_key(SPR_KEY_DEFAULT);
+	fbcon_show(hwtext);
 	return 0;
 }
 
@@ -79,15 +97,167 @@ void fb_setcolor(uint32_t argb)
 	lcd_regs->argb = argb;
 }
 
+static int fb_draw_depth = FBMODE_BPP16;
+static int fb_w = LCD_WIDTH, fb_h = LCD_HEIGHT;
+static int plot_port = -1; /* -1: not probed yet */
+static int clip_x0 = 0, clip_y0 = 0, clip_x1 = LCD_WIDTH - 1, clip_y1 = LCD_HEIGHT - 1;
+
+/* depths are FBMODE_BPP16/8/4, the scanout switches in the next vblank */
+int fb_set_mode(int scan_depth, int draw_depth)
+{
+	if (scan_depth < 0 || scan_depth > FBMODE_BPP4 || draw_depth < 0 || draw_depth > FBMODE_BPP4)
+		return -1;
+	if ((scan_depth || draw_depth) && !(*GPU_CAPS & GPU_CAP_INDEXED))
+		return -1;
+	plot_sync();
+	lcd_regs->fbmode = (lcd_regs->fbmode & FBMODE_SCALE_MASK) | FBMODE_SCAN(scan_depth) |
+					   FBMODE_DRAW(draw_depth);
+	fb_draw_depth = draw_depth;
+	return 0;
+}
+
+/* 0: native, 1: 2x, 2: 4x pixel doubling, fb_width/fb_height follow */
+int fb_set_scale(int scale)
+{
+	if (scale < 0 || scale > 2 || (scale && !(*GPU_CAPS & GPU_CAP_SCALED)))
+		return -1;
+	plot_sync();
+	lcd_regs->fbmode = (lcd_regs->fbmode & ~FBMODE_SCALE_MASK) | FBMODE_SCALE(scale);
+	if (*GPU_CAPS & GPU_CAP_SCALED) {
+		fb_w = lcd_regs->fbsize & 0xffff;
+		fb_h = lcd_regs->fbsize >> 16;
+	}
+	fb_set_clip(0, 0, fb_w - 1, fb_h - 1);
+	return 0;
+}
+
+/* the GPU scissor, opened up for ops on surfaces other than the screen */
+void gpu_scissor(bool open)
+{
+	if (!(*GPU_CAPS & GPU_CAP_CLIP))
+		return;
+	lcd_regs->clipx0y0 = open ? CLIP_XY(0, 0) : CLIP_XY(clip_x0, clip_y0);
+	lcd_regs->clipx1y1 = open ? CLIP_XY(0x7fff, 0x7fff) : CLIP_XY(clip_x1, clip_y1);
+}
+
+/* inclusive clip rect of all drawing on the screen, CPU or GPU */
+void fb_set_clip(int x0, int y0, int x1, int y1)
+{
+	plot_sync();
+	clip_x0 = x0, clip_y0 = y0, clip_x1 = x1, clip_y1 = y1;
+	gpu_scissor(false);
+}
+
+void fb_get_clip(int *x0, int *y0, int *x1, int *y1)
+{
+	*x0 = clip_x0, *y0 = clip_y0, *x1 = clip_x1, *y1 = clip_y1;
+}
+
+int fb_width(void)
+{
+	return fb_w;
+}
+
+int fb_height(void)
+{
+	return fb_h;
+}
+
+int fb_get_draw_depth(void)
+{
+	return fb_draw_depth;
+}
+
+void fb_set_palette(int idx, uint32_t argb)
+{
+	lcd_regs->palette = FB_PALETTE_ENTRY(idx, argb2rgb565(argb));
+}
+
+/* RGB 3-3-2 for 8bpp, the 16 named colors for 4bpp */
+void fb_default_palette(int depth)
+{
+	if (depth == FBMODE_BPP4) {
+		for (int i = 0; i < 16; i++)
+			fb_set_palette(i, colornames[i].value);
+		return;
+	}
+	for (int i = 0; i < 256; i++) {
+		uint32_t r = (i >> 5) * 255 / 7, g = ((i >> 2) & 7) * 255 / 7, b = (i & 3) * 255 / 3;
+		fb_set_palette(i, (r << 16) | (g << 8) | b);
+	}
+}
+
+/* use the plot port for points on the work surface when the bitstream has one */
+bool plot_port_enable(bool on)
+{
+	plot_sync();
+	plot_port = on && (*GPU_CAPS & GPU_CAP_PLOT);
+	return plot_port;
+}
+
+bool plot_port_enabled(void)
+{
+	if (plot_port < 0)
+		plot_port = (*GPU_CAPS & GPU_CAP_PLOT) != 0;
+	return plot_port;
+}
+
+/* waits until the points queued in the plot port are in PSRAM */
+void plot_sync(void)
+{
+	int waitcount = 0;
+
+	if (plot_port > 0)
+		while (waitcount++ < GPU_WAIT_MAXCOUNT && (*GPU_CTRLSTAT & CTRLSTAT_BUSY))
+			;
+}
+
+/* plot port color of argb, -1 when the port can't draw it exactly */
+static int plot_port_color(uint32_t argb)
+{
+	if (plot_port < 0)
+		plot_port = (*GPU_CAPS & GPU_CAP_PLOT) != 0;
+	if (!plot_port || fb_draw_depth == FBMODE_BPP4)
+		return -1;
+	if (fb_draw_depth == FBMODE_BPP8)
+		return argb & 0xff;
+
+	uint32_t r = (argb >> 20) & 0xf, g = (argb >> 12) & 0xf, b = (argb >> 4) & 0xf;
+	uint16_t rgb16 = (r << 1 | r >> 3) << 11 | (g << 2 | g >> 2) << 5 | (b << 1 | b >> 3);
+	if (rgb16 != argb2rgb565(argb))
+		return -1;
+	return r << 8 | g << 4 | b;
+}
+
+/* argb is the palette index at 8/4bpp */
 void plot_point(int16_t x, int16_t y, uint32_t argb)
 {
-	if (x < 0 || x > LCD_WIDTH || y < 0 || y > LCD_HEIGHT)
+	if (x < 0 || x >= fb_w || y < 0 || y >= fb_h)
+		return;
+	if (x < clip_x0 || x > clip_x1 || y < clip_y0 || y > clip_y1)
 		return;
 
-	uint32_t point_addr = ((y * LCD_WIDTH) + x) * LCD_PIXELBYTES + LCD_FBADDR;
-	uint16_t rgb16 = ((argb >> 8) & LCD_RED) |
-					 ((argb >> 5) & LCD_GREEN) |
-					 ((argb >> 3) & LCD_BLUE);
+	int c12 = plot_port_color(argb);
+	if (c12 >= 0) {
+		*PLOT_PORT = PLOT_XYC(x, y, c12);
+		return;
+	}
+
+	/* the work surface, like the port */
+	uint32_t line_addr = y * LCD_WIDTH * LCD_PIXELBYTES + lcd_regs->workaddr;
+	if (fb_draw_depth == FBMODE_BPP8) {
+		*(uint8_t *)(line_addr + x) = argb;
+		return;
+	}
+	if (fb_draw_depth == FBMODE_BPP4) {
+		/* no nibble write strobes, read-modify-write the byte */
+		volatile uint8_t *p = (uint8_t *)(line_addr + x / 2);
+		*p = (x & 1) ? (*p & 0x0f) | (argb << 4) : (*p & 0xf0) | (argb & 0x0f);
+		return;
+	}
+
+	uint32_t point_addr = line_addr + x * LCD_PIXELBYTES;
+	uint16_t rgb16 = argb2rgb565(argb);
 	// printf("setting address 0x%08x with 0x%04X\n", point_addr, rgb16);
 	*(uint16_t *)point_addr = rgb16;
 }
@@ -99,8 +269,10 @@ int plot_line(int x0, int y0, int x1, int y1, uint32_t argb)
 	int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
 	int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
 	int err = dx + dy, e2; /* error value e_xy */
+	int c12 = plot_port_color(argb);
 	for (;;) { /* loop */
-		plot_point(x0, y0, argb);
+		if (c12 < 0) plot_point(x0, y0, argb);
+		else if (x0 >= 0 && x0 < fb_w && y0 >= 0 && y0 < fb_h) *PLOT_PORT = PLOT_XYC(x0, y0, c12);
 		if (x0 == x1 && y0 == y1) break;
 		e2 = 2 * err;
 		if (e2 >= dy) { err += dy;	x0 += sx; } /* e_xy+e_x > 0 */
@@ -206,4 +378,478 @@ int plot_char(int x, int y, int fontnum, int c)
 	}
 
 	return x + char_w + (font_l > 1 ? 1 : 0);
-}
\ No newline at end of file
+}
+
+/* blit-ready fonts from sw/fontconv, indexed by the fontnum of plot_glyph() */
+static const uint8_t *const fb_fonts[] = {
+	fbf_fixed_bold10x15,
+	fbf_callibri15,
+	fbf_callibri22aa,
+};
+
+const uint8_t *fb_font(int fontnum)
+{
+	if (fontnum < 0 || fontnum >= ARRAY_SIZE(fb_fonts))
+		fontnum = 0;
+	return fb_fonts[fontnum];
+}
+
+int fb_font_count(void)
+{
+	return ARRAY_SIZE(fb_fonts);
+}
+
+/* RGB565 ramp from bg to fg, one entry per coverage level of a 1/2/4bpp font */
+void fb_color_ramp(uint16_t *ramp, int bpp, uint32_t fg_argb, uint32_t bg_argb)
+{
+	int levels = (1 << bpp) - 1;
+	for (int i = 0; i <= levels; i++) {
+		uint32_t argb = 0;
+		for (int sh = 0; sh < 24; sh += 8) {
+			int f = (fg_argb >> sh) & 0xff;
+			int b = (bg_argb >> sh) & 0xff;
+			argb |= ((b + (f - b) * i / levels) & 0xff) << sh;
+		}
+		ramp[i] = argb2rgb565(argb);
+	}
+}
+
+/*
+ * Expands one glyph row of a blit-ready font into RGB565 pixels. The font
+ * rows are already in scan order, so this is a straight table lookup.
+ */
+void fb_glyph_row(uint16_t *dst, const uint8_t *row, int width, int bpp,
+				  const uint16_t *ramp)
+{
+	int mask = (1 << bpp) - 1;
+	int bitpos = 0;
+	for (int i = 0; i < width; i++, bitpos += bpp) {
+		dst[i] = ramp[(row[bitpos >> 3] >> (8 - bpp - (bitpos & 7))) & mask];
+	}
+}
+
+/* writes a row of RGB565 pixels to the framebuffer, two pixels per store */
+void fb_write_row(uint32_t fbaddr, int x, int y, const uint16_t *pix, int count)
+{
+	uint32_t addr = fbaddr + (y * LCD_WIDTH + x) * LCD_PIXELBYTES;
+	int		 i = 0;
+
+	if (addr & 2) {
+		*(volatile uint16_t *)addr = pix[i++];
+		addr += 2;
+	}
+	for (; i + 1 < count; i += 2, addr += 4) {
+		*(volatile uint32_t *)addr = pix[i] | (pix[i + 1] << 16);
+	}
+	if (i < count)
+		*(volatile uint16_t *)addr = pix[i];
+}
+
+/*
+ * Draws character c opaque (fg on bg) with a blit-ready font at (x, y) of
+ * the surface at fbaddr, returns the x position of the next character.
+ */
+int fb_draw_glyph(uint32_t fbaddr, int x, int y, int fontnum, int c,
+				  uint32_t fg_argb, uint32_t bg_argb)
+{
+	const uint8_t	   *font = fb_font(fontnum);
+	const FBFONT_HDR   *hdr = fbfont_hdr(font);
+	const FBFONT_GLYPH *g = fbfont_glyph(font, c);
+	uint16_t			ramp[16];
+	uint16_t			pix[256];
+
+	if (g == NULL)
+		return x;
+
+	int w = MIN((int)g->width, LCD_WIDTH - x);
+	int h = MIN((int)hdr->height, LCD_HEIGHT - y);
+	if (x < 0 || y < 0 || w <= 0)
+		return x + g->advance;
+
+	fb_color_ramp(ramp, hdr->bpp, fg_argb, bg_argb);
+	/* the gap to the next glyph is part of the opaque cell */
+	for (int i = g->width; i < g->advance; i++)
+		pix[i] = ramp[0];
+	w = MIN((int)g->advance, LCD_WIDTH - x);
+
+	const uint8_t *row = font + g->offset;
+	for (int j = 0; j < h; j++, row += g->stride) {
+		fb_glyph_row(pix, row, g->width, hdr->bpp, ramp);
+		fb_write_row(fbaddr, x, y + j, pix, w);
+	}
+	return x + g->advance;
+}
+
+int plot_glyph(int x, int y, int fontnum, int c, uint32_t fg_argb, uint32_t bg_argb)
+{
+	return fb_draw_glyph(LCD_FBADDR, x, y, fontnum, c, fg_argb, bg_argb);
+}
+
+/* starts a GPU opcode and polls until it is done, returns the poll count */
+int gpu_exec(int opcode)
+{
+	int waitcount = 0;
+
+	lcd_regs->ctrlstat = 0;
+	lcd_regs->ctrlstat = opcode << 1 | 1;
+	while (waitcount++ < GPU_WAIT_MAXCOUNT && (*GPU_CTRLSTAT & CTRLSTAT_BUSY))
+		;
+	lcd_regs->ctrlstat = 0;
+	return waitcount;
+}
+
+/*
+ * GPU filled rect on any RGB565 surface with the framebuffer line stride
+ * (console, glyph atlas), whatever the current draw depth.
+ */
+static int fill_rect_op(int opcode, uint32_t fbaddr, int x, int y, int w, int h, uint32_t argb)
+{
+	uint32_t tmp_workaddr = lcd_regs->workaddr;
+	uint32_t tmp_color = lcd_regs->argb;
+	uint32_t tmp_mode = lcd_regs->fbmode;
+
+	if (w <= 0 || h <= 0)
+		return 0;
+	plot_sync();
+	gpu_scissor(true);
+	lcd_regs->fbmode = tmp_mode & ~FBMODE_DRAW_MASK;
+	lcd_regs->workaddr = fbaddr;
+	lcd_regs->argb = argb;
+	lcd_regs->x0y0 = (x & 0xffff) | ((y & 0xffff) << 16);
+	lcd_regs->x1y1 = ((x + w - 1) & 0xffff) | (((y + h - 1) & 0xffff) << 16);
+	int waitcount = gpu_exec(opcode);
+	gpu_scissor(false);
+	lcd_regs->workaddr = tmp_workaddr;
+	lcd_regs->argb = tmp_color;
+	lcd_regs->fbmode = tmp_mode;
+	return waitcount;
+}
+
+int gpu_fill_rect(uint32_t fbaddr, int x, int y, int w, int h, uint32_t argb)
+{
+	return fill_rect_op(GPU_FRECT, fbaddr, x, y, w, h, argb);
+}
+
+/* translucent panel, argb's alpha byte mixes the color over the surface */
+int gpu_fill_rect_alpha(uint32_t fbaddr, int x, int y, int w, int h, uint32_t argb)
+{
+	if (!(*GPU_CAPS & GPU_CAP_BLEND))
+		return -1;
+	return fill_rect_op(GPU_FRECT_BLEND, fbaddr, x, y, w, h, argb);
+}
+
+static int blit_op(int opcode, uint32_t src, int sx, int sy, uint32_t dst, int dx, int dy,
+				   int w, int h)
+{
+	uint32_t tmp_workaddr = lcd_regs->workaddr;
+	uint32_t tmp_mode = lcd_regs->fbmode;
+
+	plot_sync();
+	gpu_scissor(true);
+	lcd_regs->fbmode = tmp_mode & ~FBMODE_DRAW_MASK;
+	lcd_regs->workaddr = dst;
+	lcd_regs->srcaddr = src;
+	lcd_regs->srcxy = (sx & 0xffff) | ((sy & 0xffff) << 16);
+	lcd_regs->x0y0 = (dx & 0xffff) | ((dy & 0xffff) << 16);
+	lcd_regs->x1y1 = ((dx + w - 1) & 0xffff) | (((dy + h - 1) & 0xffff) << 16);
+	int waitcount = gpu_exec(opcode);
+	gpu_scissor(false);
+	lcd_regs->workaddr = tmp_workaddr;
+	lcd_regs->fbmode = tmp_mode;
+	return waitcount;
+}
+
+/* GPU blit of a w x h rect, both RGB565 surfaces with the framebuffer line stride */
+int gpu_blit(uint32_t src, int sx, int sy, uint32_t dst, int dx, int dy, int w, int h)
+{
+	return blit_op(GPU_BLIT, src, sx, sy, dst, dx, dy, w, h);
+}
+
+/* like gpu_blit, the source mixed over dst with alpha 0..255 */
+int gpu_blit_alpha(uint32_t src, int sx, int sy, uint32_t dst, int dx, int dy, int w, int h,
+				   int alpha)
+{
+	uint32_t tmp_color = lcd_regs->argb;
+
+	if (!(*GPU_CAPS & GPU_CAP_BLEND))
+		return -1;
+	lcd_regs->argb = ARGB_ALPHA(tmp_color, alpha);
+	int waitcount = blit_op(GPU_BLIT_BLEND, src, sx, sy, dst, dx, dy, w, h);
+	lcd_regs->argb = tmp_color;
+	return waitcount;
+}
+
+/*
+ * Triangles go to the GPU as two trapezoids split at the middle vertex,
+ * set up here in fixed point. Pixel centers are sampled: line y is drawn
+ * when the top <= y + 0.5 < the bottom, pixel x when the left edge <=
+ * x + 0.5 < the right one, so triangles sharing an edge neither overlap
+ * nor leave a gap. Shading is the plane through the three vertex colors.
+ */
+typedef struct {
+	int32_t x;	/* 16.16 at the center of the first line, less half a pixel */
+	int32_t dx; /* per line */
+} TRAP_EDGE;
+
+typedef struct {
+	int32_t c, dx, dy; /* 8.8 at the first vertex, per pixel and per line */
+} TRAP_PLANE;
+
+static void trap_edge(TRAP_EDGE *e, const FB_VERTEX *a, const FB_VERTEX *b, int y)
+{
+	e->dx = (b->y != a->y) ? ((int32_t)(b->x - a->x) << 16) / (b->y - a->y) : 0;
+	e->x = ((int32_t)a->x << 16) + e->dx * (y - a->y) + e->dx / 2 - 0x8000;
+}
+
+static int32_t clamp16(int32_t v, int32_t lo, int32_t hi)
+{
+	return v < lo ? lo : v > hi ? hi : v;
+}
+
+/* lines y..y1 - 1, pl the R, G, B planes with their origin at org, or NULL */
+static void gpu_trap(int y, int y1, const TRAP_EDGE *l, const TRAP_EDGE *r,
+					 const TRAP_PLANE *pl, const FB_VERTEX *org)
+{
+	int32_t c[3], dy[3];
+
+	if (y >= y1)
+		return;
+	lcd_regs->x0y0 = CLIP_XY(-0x8000, y);
+	lcd_regs->x1y1 = CLIP_XY(0x7fff, y1 - 1);
+	lcd_regs->trapxl = l->x;
+	lcd_regs->trapdxl = l->dx;
+	lcd_regs->trapxr = r->x;
+	lcd_regs->trapdxr = r->dx;
+	if (!pl) {
+		gpu_exec(GPU_TRAP_FLAT);
+		return;
+	}
+	for (int k = 0; k < 3; k++) {
+		/* at the left edge of the first line, stepped along it */
+		int32_t ex = l->x + 0x8000 - ((int32_t)org->x << 16);
+		c[k] = pl[k].c + (int32_t)(((int64_t)pl[k].dx * ex) >> 16) +
+			   pl[k].dy * (y - org->y) + pl[k].dy / 2;
+		dy[k] = pl[k].dy + (int32_t)(((int64_t)pl[k].dx * l->dx) >> 16);
+	}
+	lcd_regs->trapr = TRAP_CHANNEL(clamp16(c[0], 0, 0xffff), pl[0].dx);
+	lcd_regs->trapg = TRAP_CHANNEL(clamp16(c[1], 0, 0xffff), pl[1].dx);
+	lcd_regs->trapb = TRAP_CHANNEL(clamp16(c[2], 0, 0xffff), pl[2].dx);
+	lcd_regs->trapdrg = TRAP_DY(clamp16(dy[0], -0x8000, 0x7fff), clamp16(dy[1], -0x8000, 0x7fff));
+	lcd_regs->trapdb = TRAP_DY(clamp16(dy[2], -0x8000, 0x7fff), 0);
+	gpu_exec(GPU_TRAP_SHADED);
+}
+
+/*
+ * GPU triangle on the work surface, clipped to the clip rect. Flat ones
+ * take the color of v0, shaded ones interpolate the vertex colors at
+ * 16bpp. Coordinates are limited to +-TRI_COORD_MAX.
+ */
+int gpu_triangle(const FB_VERTEX *v0, const FB_VERTEX *v1, const FB_VERTEX *v2, bool shaded)
+{
+	const FB_VERTEX *a = v0, *b = v1, *c = v2, *t;
+	TRAP_EDGE		 e_long, e_short;
+	TRAP_PLANE		 pl[3], *ppl = NULL;
+	int32_t			 area2;
+	uint32_t		 tmp_color = lcd_regs->argb;
+
+	if (!(*GPU_CAPS & GPU_CAP_TRAP))
+		return -1;
+	for (int i = 0; i < 3; i++) {
+		const FB_VERTEX *v = (i == 0) ? v0 : (i == 1) ? v1 : v2;
+		if (abs(v->x) > TRI_COORD_MAX || abs(v->y) > TRI_COORD_MAX)
+			return -1;
+	}
+	if (b->y < a->y)
+		t = a, a = b, b = t;
+	if (c->y < b->y)
+		t = b, b = c, c = t;
+	if (b->y < a->y)
+		t = a, a = b, b = t;
+	/* > 0: b is right of the long edge a-c */
+	area2 = (b->x - a->x) * (c->y - a->y) - (c->x - a->x) * (b->y - a->y);
+	if (area2 == 0)
+		return 0;
+
+	if (shaded && fb_draw_depth == FBMODE_BPP16) {
+		for (int k = 0; k < 3; k++) {
+			int sh = 16 - 8 * k;
+			int ca = (a->argb >> sh) & 0xff;
+			int db = ((b->argb >> sh) & 0xff) - ca;
+			int dc = ((c->argb >> sh) & 0xff) - ca;
+			pl[k].c = ca << 8;
+			pl[k].dx = clamp16((db * (c->y - a->y) - dc * (b->y - a->y)) * 256 / area2,
+							   -0x8000, 0x7fff);
+			pl[k].dy = clamp16((dc * (b->x - a->x) - db * (c->x - a->x)) * 256 / area2,
+							   -0x8000, 0x7fff);
+		}
+		ppl = pl;
+	}
+	plot_sync();
+	lcd_regs->argb = v0->argb;
+
+	trap_edge(&e_long, a, c, a->y);
+	trap_edge(&e_short, a, b, a->y);
+	if (area2 > 0)
+		gpu_trap(a->y, b->y, &e_long, &e_short, ppl, a);
+	else
+		gpu_trap(a->y, b->y, &e_short, &e_long, ppl, a);
+	trap_edge(&e_long, a, c, b->y);
+	trap_edge(&e_short, b, c, b->y);
+	if (area2 > 0)
+		gpu_trap(b->y, c->y, &e_long, &e_short, ppl, a);
+	else
+		gpu_trap(b->y, c->y, &e_short, &e_long, ppl, a);
+	lcd_regs->argb = tmp_color;
+	return 0;
+}
+
+/* convex polygon, as a fan of triangles around v[0] */
+int gpu_polygon(const FB_VERTEX *v, int n, bool shaded)
+{
+	if (n < 3)
+		return -1;
+	for (int i = 1; i + 1 < n; i++)
+		if (gpu_triangle(&v[0], &v[i], &v[i + 1], shaded) < 0)
+			return -1;
+	return 0;
+}
+
+/* t = t[0] + t[1] * x + t[2] * y + t[3] * (x * x + y * y), see hwdefs.h */
+static int gpu_gradient(int x, int y, int w, int h, const int32_t *t, uint32_t ctrl,
+						uint32_t c0, uint32_t c1)
+{
+	uint32_t tmp_color = lcd_regs->argb;
+
+	if (!(*GPU_CAPS & GPU_CAP_GRAD))
+		return -1;
+	if (w <= 0 || h <= 0)
+		return 0;
+	plot_sync();
+	lcd_regs->gradc0 = c0;
+	lcd_regs->gradc1 = c1;
+	lcd_regs->gradt0 = t[0];
+	lcd_regs->gradtx = t[1];
+	lcd_regs->gradty = t[2];
+	lcd_regs->gradq = t[3];
+	lcd_regs->gradctrl = ctrl;
+	lcd_regs->argb = c0;
+	lcd_regs->x0y0 = (x & 0xffff) | ((y & 0xffff) << 16);
+	lcd_regs->x1y1 = ((x + w - 1) & 0xffff) | (((y + h - 1) & 0xffff) << 16);
+	int waitcount = gpu_exec(GPU_GRADIENT);
+	lcd_regs->argb = tmp_color;
+	return waitcount;
+}
+
+/*
+ * GPU gradient fill of a w x h rect of the work surface, clipped to the
+ * clip rect, at 16bpp (a flat fill with the first color at 8/4bpp). The
+ * color goes from the one of from to the one of to along the line between
+ * them and stays beyond. Points are limited to +-TRI_COORD_MAX.
+ */
+int gpu_gradient_linear(int x, int y, int w, int h, const FB_VERTEX *from, const FB_VERTEX *to,
+						bool dither)
+{
+	int32_t dx = to->x - from->x, dy = to->y - from->y;
+	int64_t len2 = (int64_t)dx * dx + (int64_t)dy * dy;
+	int32_t t[4];
+
+	if (len2 == 0 || abs(from->x) > TRI_COORD_MAX || abs(from->y) > TRI_COORD_MAX ||
+		abs(to->x) > TRI_COORD_MAX || abs(to->y) > TRI_COORD_MAX)
+		return -1;
+	t[0] = -((((int64_t)from->x * dx + (int64_t)from->y * dy) << 12) / len2);
+	t[1] = ((int64_t)dx << 24) / len2;
+	t[2] = ((int64_t)dy << 24) / len2;
+	t[3] = 0;
+	return gpu_gradient(x, y, w, h, t, dither ? GRAD_DITHER : 0, from->argb, to->argb);
+}
+
+/*
+ * Like gpu_gradient_linear, from the color of center to outer at radius
+ * r >= GRAD_RADIUS_MIN and beyond.
+ */
+int gpu_gradient_radial(int x, int y, int w, int h, const FB_VERTEX *center, int r,
+						uint32_t outer, bool dither)
+{
+	int64_t q;
+	int32_t t[4];
+
+	if (r < GRAD_RADIUS_MIN || abs(center->x) > TRI_COORD_MAX || abs(center->y) > TRI_COORD_MAX)
+		return -1;
+	/* the rest derived from the rounded q, so t stays a circle's */
+	q = ((int64_t)1 << 28) / ((int64_t)r * r);
+	if (q == 0)
+		q = 1;
+	t[0] = (q * ((int64_t)center->x * center->x + (int64_t)center->y * center->y)) >> 16;
+	t[1] = (-2 * q * center->x) >> 4;
+	t[2] = (-2 * q * center->y) >> 4;
+	t[3] = q;
+	return gpu_gradient(x, y, w, h, t, GRAD_RADIAL | (dither ? GRAD_DITHER : 0), center->argb,
+						outer);
+}
+
+/*
+ * GPU fill of the n spans of a list in PSRAM (SPAN_ALIGN aligned, e.g. from
+ * surface_heap_alloc) on the work surface, clipped to the clip rect. The
+ * spans take their own colors, or all argb.
+ */
+int gpu_fill_spans(const FB_SPAN *list, int n, uint32_t argb, bool colors)
+{
+	uint32_t tmp_color = lcd_regs->argb;
+
+	if (!(*GPU_CAPS & GPU_CAP_SPANS) || ((uint32_t)list & (SPAN_ALIGN - 1)) ||
+		n > SPAN_COUNT_MAX)
+		return -1;
+	if (n <= 0)
+		return 0;
+	plot_sync();
+	lcd_regs->argb = argb;
+	lcd_regs->spanaddr = (uint32_t)list;
+	lcd_regs->spanctrl = SPAN_CTRL(n, colors);
+	int waitcount = gpu_exec(GPU_SPANS);
+	lcd_regs->argb = tmp_color;
+	return waitcount;
+}
+
+/*
+ * CPU copy of a w x h rect, row by row in ascending addresses so each row
+ * walks through whole PSRAM bursts. Uses word copies when source and
+ * destination have the same halfword alignment.
+ */
+void fb_copy_rect_cpu(uint32_t src, int sx, int sy, uint32_t dst, int dx, int dy, int w, int h)
+{
+	const uint32_t stride = LCD_WIDTH * LCD_PIXELBYTES;
+	uint32_t	   saddr = src + sy * stride + sx * LCD_PIXELBYTES;
+	uint32_t	   daddr = dst + dy * stride + dx * LCD_PIXELBYTES;
+
+	for (int j = 0; j < h; j++, saddr += stride, daddr += stride) {
+		volatile uint16_t *s16 = (uint16_t *)saddr;
+		volatile uint16_t *d16 = (uint16_t *)daddr;
+		int				   i = 0;
+
+		if (((saddr ^ daddr) & 2) == 0) {
+			if (daddr & 2) {
+				*d16++ = *s16++;
+				i++;
+			}
+			volatile uint32_t *s32 = (uint32_t *)s16;
+			volatile uint32_t *d32 = (uint32_t *)d16;
+			for (; i + 1 < w; i += 2)
+				*d32++ = *s32++;
+			s16 = (uint16_t *)s32;
+			d16 = (uint16_t *)d32;
+		}
+		for (; i < w; i++)
+			*d16++ = *s16++;
+	}
+}
+
+/* copies a rect between surfaces, with the GPU blit when the bitstream has it */
+void fb_copy_rect(uint32_t src, int sx, int sy, uint32_t dst, int dx, int dy, int w, int h)
+{
+	if (w <= 0 || h <= 0)
+		return;
+	if (*GPU_CAPS & GPU_CAP_BLIT)
+		gpu_blit(src, sx, sy, dst, dx, dy, w, h);
+	else
+		fb_copy_rect_cpu(src, sx, sy, dst, dx, dy, w, h);
+}
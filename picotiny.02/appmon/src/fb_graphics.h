@@ -2,6 +2,14 @@
 #define __FB_GRAPHICS_H__
 
 #include <stdint.h>
+#include <stdbool.h>
+
+#include "hwdefs.h"
+
+static inline uint16_t argb2rgb565(uint32_t argb)
+{
+	return ((argb >> 8) & LCD_RED) | ((argb >> 5) & LCD_GREEN) | ((argb >> 3) & LCD_BLUE);
+}
 
 typedef struct {
 	const char	  *key;
@@ -13,10 +21,79 @@ extern const KEY_UINT32_PAIR colornames[];
 const char *colorname(uint32_t argb);
 int str2argb32(const char *color_str, uint32_t *argb32);
 void fb_setcolor(uint32_t argb);
+int fb_set_mode(int scan_depth, int draw_depth);
+int fb_get_draw_depth(void);
+int fb_set_scale(int scale);
+void fb_set_clip(int x0, int y0, int x1, int y1);
+void fb_get_clip(int *x0, int *y0, int *x1, int *y1);
+int fb_width(void);
+int fb_height(void);
+void fb_set_palette(int idx, uint32_t argb);
+void fb_default_palette(int depth);
 
+bool plot_port_enable(bool on);
+bool plot_port_enabled(void);
+void plot_sync(void);
 void plot_point(int16_t x, int16_t y, uint32_t argb);
 int plot_line(int x0, int y0, int x1, int y1, uint32_t argb);
 int plot_circle(int xm, int ym, int r, uint32_t argb);
 int plot_char(int x, int y, int font, int c);
 
+const uint8_t *fb_font(int fontnum);
+int fb_font_count(void);
+void fb_color_ramp(uint16_t *ramp, int bpp, uint32_t fg_argb, uint32_t bg_argb);
+void fb_glyph_row(uint16_t *dst, const uint8_t *row, int width, int bpp,
+				  const uint16_t *ramp);
+void fb_write_row(uint32_t fbaddr, int x, int y, const uint16_t *pix, int count);
+int fb_draw_glyph(uint32_t fbaddr, int x, int y, int fontnum, int c,
+				  uint32_t fg_argb, uint32_t bg_argb);
+int plot_glyph(int x, int y, int fontnum, int c, uint32_t fg_argb, uint32_t bg_argb);
+
+#define GPU_WAIT_MAXCOUNT 1000000
+
+int gpu_exec(int opcode);
+void gpu_scissor(bool open);
+int gpu_fill_rect(uint32_t fbaddr, int x, int y, int w, int h, uint32_t argb);
+int gpu_blit(uint32_t src, int sx, int sy, uint32_t dst, int dx, int dy, int w, int h);
+int gpu_fill_rect_alpha(uint32_t fbaddr, int x, int y, int w, int h, uint32_t argb);
+int gpu_blit_alpha(uint32_t src, int sx, int sy, uint32_t dst, int dx, int dy, int w, int h,
+				   int alpha);
+
+#define TRI_COORD_MAX 4095
+
+typedef struct {
+	int16_t	 x, y;
+	uint32_t argb;
+} FB_VERTEX;
+
+int gpu_triangle(const FB_VERTEX *v0, const FB_VERTEX *v1, const FB_VERTEX *v2, bool shaded);
+int gpu_polygon(const FB_VERTEX *v, int n, bool shaded);
+
+#define GRAD_RADIUS_MIN 8
+
+int gpu_gradient_linear(int x, int y, int w, int h, const FB_VERTEX *from, const FB_VERTEX *to,
+						bool dither);
+int gpu_gradient_radial(int x, int y, int w, int h, const FB_VERTEX *center, int r,
+						uint32_t outer, bool dither);
+
+/* span list entry, see GPU_SPANS in hwdefs.h */
+typedef struct {
+	int16_t	 x0, x1; /* inclusive */
+	int16_t	 y;
+	uint16_t color; /* RGB565, the palette index at 8/4bpp */
+} FB_SPAN;
+
+/* sets a span of a list in PSRAM with two word stores instead of four */
+static inline void span_set(FB_SPAN *s, int x0, int x1, int y, uint16_t color)
+{
+	volatile uint32_t *w = (uint32_t *)s;
+
+	w[0] = (x0 & 0xffff) | ((uint32_t)x1 << 16);
+	w[1] = (y & 0xffff) | ((uint32_t)color << 16);
+}
+
+int gpu_fill_spans(const FB_SPAN *list, int n, uint32_t argb, bool colors);
+void fb_copy_rect_cpu(uint32_t src, int sx, int sy, uint32_t dst, int dx, int dy, int w, int h);
+void fb_copy_rect(uint32_t src, int sx, int sy, uint32_t dst, int dx, int dy, int w, int h);
+
 #endif /* __FB_GRAPHICS_H__ */
\ No newline at end of file
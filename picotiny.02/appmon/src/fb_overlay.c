@@ -0,0 +1,49 @@
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hwdefs.h"
+#include "fb_overlay.h"
+
+bool overlay_available(void)
+{
+	return (*GPU_CAPS & GPU_CAP_OVERLAY) != 0;
+}
+
+/*
+ * Shows the w x h top left part of the surface at (x, y). The surface line
+ * stride is fixed at 2048 bytes, like the framebuffers.
+ */
+int overlay_set_window(uint32_t surface, int x, int y, int w, int h)
+{
+	if (surface & 0x7ff)
+		return -1;
+	if (x < 0 || y < 0 || w <= 0 || h <= 0 || x + w > LCD_WIDTH || y + h > LCD_HEIGHT)
+		return -1;
+	lcd_regs->ovladdr = surface;
+	lcd_regs->ovlx0y0 = OVL_XY(x, y);
+	lcd_regs->ovlx1y1 = OVL_XY(x + w - 1, y + h - 1);
+	return 0;
+}
+
+void overlay_set_mode(int alpha, bool use_key, uint16_t key565)
+{
+	uint32_t ctrl = lcd_regs->ovlctrl & OVLCTRL_ENABLE;
+
+	ctrl |= OVLCTRL_ALPHA(alpha) | OVLCTRL_KEYCOLOR(key565);
+	if (use_key)
+		ctrl |= OVLCTRL_KEY;
+	lcd_regs->ovlctrl = ctrl;
+}
+
+void overlay_show(bool on)
+{
+	if (on)
+		lcd_regs->ovlctrl |= OVLCTRL_ENABLE;
+	else
+		lcd_regs->ovlctrl &= ~OVLCTRL_ENABLE;
+}
+
+bool overlay_shown(void)
+{
+	return (lcd_regs->ovlctrl & OVLCTRL_ENABLE) != 0;
+}
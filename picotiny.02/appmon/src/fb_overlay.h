@@ -0,0 +1,17 @@
+#ifndef __FB_OVERLAY_H__
+#define __FB_OVERLAY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hwdefs.h"
+
+#define OVL_KEY_DEFAULT 0xF81F /* magenta */
+
+bool overlay_available(void);
+int	 overlay_set_window(uint32_t surface, int x, int y, int w, int h);
+void overlay_set_mode(int alpha, bool use_key, uint16_t key565);
+void overlay_show(bool on);
+bool overlay_shown(void);
+
+#endif /* __FB_OVERLAY_H__ */
@@ -0,0 +1,95 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "hwdefs.h"
+#include "fb_sprite.h"
+
+// clang-format off
+/* X outline, o fill, anything else transparent */
+static const char *arrow_shape[] = {
+	"X           ",
+	"XX          ",
+	"XoX         ",
+	"XooX        ",
+	"XoooX       ",
+	"XooooX      ",
+	"XoooooX     ",
+	"XooooooX    ",
+	"XoooooooX   ",
+	"XooooooooX  ",
+	"XoooooooooX ",
+	"XooooooXXXXX",
+	"XoooXooX    ",
+	"XooXXooX    ",
+	"XoX  XooX   ",
+	"XX   XooX   ",
+	"X     XooX  ",
+	"      XooX  ",
+	"       XX   ",
+	NULL
+};
+// clang-format on
+
+static uint16_t spr_key = SPR_KEY_DEFAULT;
+
+bool sprite_available(void)
+{
+	return (*GPU_CAPS & GPU_CAP_SPRITES) != 0;
+}
+
+/* loads SPR_W x SPR_H RGB565 pixels, one store each */
+void sprite_load(int n, const uint16_t *pix)
+{
+	volatile uint32_t *dst = SPR_PIXEL(n, 0, 0);
+	for (int i = 0; i < SPR_W * SPR_H; i++)
+		dst[i] = pix[i];
+}
+
+/* copies a SPR_W x SPR_H block of a surface into sprite n */
+void sprite_grab(int n, uint32_t fbaddr, int x, int y)
+{
+	for (int j = 0; j < SPR_H; j++) {
+		volatile uint16_t *src = (uint16_t *)(fbaddr + ((y + j) * LCD_WIDTH + x) * LCD_PIXELBYTES);
+		volatile uint32_t *dst = SPR_PIXEL(n, 0, j);
+		for (int i = 0; i < SPR_W; i++)
+			dst[i] = src[i];
+	}
+}
+
+/* a mouse pointer with its hot spot at the top left pixel */
+void sprite_make_arrow(int n, uint16_t fill, uint16_t outline)
+{
+	int y = 0;
+
+	for (; arrow_shape[y] && y < SPR_H; y++) {
+		const char *p = arrow_shape[y];
+		for (int x = 0; x < SPR_W; x++) {
+			char c = *p ? *p++ : ' ';
+			*SPR_PIXEL(n, x, y) = (c == 'X') ? outline : (c == 'o') ? fill : spr_key;
+		}
+	}
+	for (; y < SPR_H; y++)
+		for (int x = 0; x < SPR_W; x++)
+			*SPR_PIXEL(n, x, y) = spr_key;
+}
+
+void sprite_set_key(uint16_t rgb565)
+{
+	spr_key = rgb565;
+	lcd_regs->sprkey = rgb565;
+}
+
+/* takes effect at the next frame, so a moving sprite never tears */
+void sprite_move(int n, int x, int y)
+{
+	lcd_regs->sprpos[n] = SPR_XY(x, y);
+}
+
+void sprite_show(int n, bool on)
+{
+	if (on)
+		lcd_regs->sprenable |= 1 << n;
+	else
+		lcd_regs->sprenable &= ~(1 << n);
+}
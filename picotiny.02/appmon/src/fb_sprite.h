@@ -0,0 +1,19 @@
+#ifndef __FB_SPRITE_H__
+#define __FB_SPRITE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hwdefs.h"
+
+#define SPR_KEY_DEFAULT 0xF81F /* magenta */
+
+bool sprite_available(void);
+void sprite_load(int n, const uint16_t *pix);
+void sprite_grab(int n, uint32_t fbaddr, int x, int y);
+void sprite_make_arrow(int n, uint16_t fill, uint16_t outline);
+void sprite_set_key(uint16_t rgb565);
+void sprite_move(int n, int x, int y);
+void sprite_show(int n, bool on);
+
+#endif /* __FB_SPRITE_H__ */
@@ -0,0 +1,263 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "hwdefs.h"
+#include "fb_graphics.h"
+#include "fb_surface.h"
+
+/* the heap in address order, one region per entry, free neighbours merged */
+typedef struct {
+	uint32_t addr;
+	uint32_t size;
+	bool	 used;
+} SURF_REGION;
+
+static SURF_REGION regions[SURF_MAX_REGIONS];
+static int		   nregions;
+
+static void heap_init(void)
+{
+	regions[0].addr = SURF_HEAP_ADDR;
+	regions[0].size = SURF_HEAP_END - SURF_HEAP_ADDR;
+	regions[0].used = false;
+	nregions = 1;
+}
+
+static void region_remove(int i)
+{
+	for (; i < nregions - 1; i++)
+		regions[i] = regions[i + 1];
+	nregions--;
+}
+
+/* bytes per line of w pixels, rounded up to whole PSRAM bursts */
+int surface_stride(int w, int depth)
+{
+	uint32_t burst = GPU_CAP_BURST(*GPU_CAPS);
+	int		 unit = (burst ? burst : 16) * 2;
+	int		 bytes = (w * (16 >> depth) + 7) / 8;
+
+	return (bytes + unit - 1) & ~(unit - 1);
+}
+
+/* a region of size bytes in SURF_ALIGN steps, 0 when none is left */
+uint32_t surface_heap_alloc(uint32_t size)
+{
+	if (!nregions)
+		heap_init();
+	if (size == 0)
+		return 0;
+	size = (size + SURF_ALIGN - 1) & ~(SURF_ALIGN - 1);
+
+	for (int i = 0; i < nregions; i++) {
+		SURF_REGION *r = &regions[i];
+		if (r->used || r->size < size)
+			continue;
+		if (r->size > size) {
+			/* split, the rest stays free behind it */
+			if (nregions == SURF_MAX_REGIONS)
+				return 0;
+			for (int j = nregions; j > i + 1; j--)
+				regions[j] = regions[j - 1];
+			nregions++;
+			regions[i + 1].addr = r->addr + size;
+			regions[i + 1].size = r->size - size;
+			regions[i + 1].used = false;
+			r->size = size;
+		}
+		r->used = true;
+		return r->addr;
+	}
+	return 0;
+}
+
+void surface_heap_free(uint32_t addr)
+{
+	for (int i = 0; i < nregions; i++) {
+		if (regions[i].addr != addr || !regions[i].used)
+			continue;
+		regions[i].used = false;
+		if (i + 1 < nregions && !regions[i + 1].used) {
+			regions[i].size += regions[i + 1].size;
+			region_remove(i + 1);
+		}
+		if (i > 0 && !regions[i - 1].used) {
+			regions[i - 1].size += regions[i].size;
+			region_remove(i);
+		}
+		break;
+	}
+}
+
+int surface_alloc(FB_SURFACE *s, int w, int h, int depth)
+{
+	uint32_t addr;
+	int		 stride;
+
+	if (w <= 0 || h <= 0 || depth < FBMODE_BPP16 || depth > FBMODE_BPP4)
+		return -1;
+	stride = surface_stride(w, depth);
+	if (stride > 0xffff)
+		return -1;
+	addr = surface_heap_alloc(stride * h);
+	if (!addr)
+		return -1;
+	s->addr = addr;
+	s->w = w;
+	s->h = h;
+	s->stride = stride;
+	s->depth = depth;
+	return 0;
+}
+
+void surface_free(FB_SURFACE *s)
+{
+	surface_heap_free(s->addr);
+	s->addr = 0;
+}
+
+/* describes a framebuffer as a surface at the current draw depth */
+void surface_screen(FB_SURFACE *s, uint32_t fbaddr)
+{
+	s->addr = fbaddr;
+	s->w = fb_width();
+	s->h = fb_height();
+	s->stride = LCD_WIDTH * LCD_PIXELBYTES;
+	s->depth = fb_get_draw_depth();
+}
+
+/* returns the free bytes */
+uint32_t surface_heap_info(uint32_t *largest, int *used)
+{
+	uint32_t free = 0;
+
+	if (!nregions)
+		heap_init();
+	*largest = 0;
+	*used = 0;
+	for (int i = 0; i < nregions; i++) {
+		if (regions[i].used) {
+			(*used)++;
+			continue;
+		}
+		free += regions[i].size;
+		if (regions[i].size > *largest)
+			*largest = regions[i].size;
+	}
+	return free;
+}
+
+void surface_heap_dump(void)
+{
+	if (!nregions)
+		heap_init();
+	for (int i = 0; i < nregions; i++)
+		printf("0x%08lX %8ld %s\n", regions[i].addr, regions[i].size,
+			   regions[i].used ? "used" : "free");
+}
+
+/*
+ * Points the GPU at dst (and src for a blit) and runs opcode, everything
+ * but x0y0/x1y1/srcxy is restored afterwards.
+ */
+static int surface_exec(int opcode, const FB_SURFACE *dst, const FB_SURFACE *src)
+{
+	uint32_t tmp_workaddr = lcd_regs->workaddr;
+	uint32_t tmp_mode = lcd_regs->fbmode;
+
+	if (!(*GPU_CAPS & GPU_CAP_SURFACE))
+		return -1;
+	plot_sync();
+	gpu_scissor(true);
+	lcd_regs->fbmode = (tmp_mode & ~FBMODE_DRAW_MASK) | FBMODE_DRAW(dst->depth);
+	lcd_regs->workaddr = dst->addr;
+	lcd_regs->size = TARGET_SIZE(dst->w, dst->h);
+	lcd_regs->stride = TARGET_STRIDE(src ? src->stride : 0, dst->stride);
+	if (src)
+		lcd_regs->srcaddr = src->addr;
+	int waitcount = gpu_exec(opcode);
+	lcd_regs->size = 0;
+	lcd_regs->stride = 0;
+	gpu_scissor(false);
+	lcd_regs->workaddr = tmp_workaddr;
+	lcd_regs->fbmode = tmp_mode;
+	return waitcount;
+}
+
+/* argb is the palette index at 8/4bpp, like the screen ops */
+int surface_clear(const FB_SURFACE *s, uint32_t argb)
+{
+	uint32_t tmp_color = lcd_regs->argb;
+
+	lcd_regs->argb = argb;
+	int waitcount = surface_exec(GPU_SETBG, s, NULL);
+	lcd_regs->argb = tmp_color;
+	return waitcount;
+}
+
+int surface_fill_rect(const FB_SURFACE *s, int x, int y, int w, int h, uint32_t argb)
+{
+	uint32_t tmp_color = lcd_regs->argb;
+
+	if (w <= 0 || h <= 0)
+		return 0;
+	lcd_regs->argb = argb;
+	lcd_regs->x0y0 = (x & 0xffff) | ((y & 0xffff) << 16);
+	lcd_regs->x1y1 = ((x + w - 1) & 0xffff) | (((y + h - 1) & 0xffff) << 16);
+	int waitcount = surface_exec(GPU_FRECT, s, NULL);
+	lcd_regs->argb = tmp_color;
+	return waitcount;
+}
+
+/* both surfaces at the same depth, clipped to dst */
+int surface_blit(const FB_SURFACE *src, int sx, int sy, const FB_SURFACE *dst, int dx, int dy,
+				 int w, int h)
+{
+	if (src->depth != dst->depth || !(*GPU_CAPS & GPU_CAP_BLIT))
+		return -1;
+	if (w <= 0 || h <= 0)
+		return 0;
+	lcd_regs->srcxy = (sx & 0xffff) | ((sy & 0xffff) << 16);
+	lcd_regs->x0y0 = (dx & 0xffff) | ((dy & 0xffff) << 16);
+	lcd_regs->x1y1 = ((dx + w - 1) & 0xffff) | (((dy + h - 1) & 0xffff) << 16);
+	return surface_exec(GPU_BLIT, dst, src);
+}
+
+/*
+ * Nearest-neighbor blit of sw x sh at sx, sy of src into dw x dh at dx, dy
+ * of dst, rotated clockwise by rot (XFORM_ROT*), scaled by any fraction.
+ * Both at 16bpp, src up to XFORM_SRC_MAX square. Target pixel centers
+ * sample the source, clipped to dst.
+ */
+int surface_blit_scaled(const FB_SURFACE *src, int sx, int sy, int sw, int sh,
+						const FB_SURFACE *dst, int dx, int dy, int dw, int dh, int rot)
+{
+	/* du/dx, dv/dx, du/dy, dv/dy in source steps per target pixel */
+	static const int8_t dir[4][4] = {{1, 0, 0, 1}, {0, -1, 1, 0}, {-1, 0, 0, -1}, {0, 1, -1, 0}};
+	uint32_t			du, dv, u, v;
+
+	if (!(*GPU_CAPS & GPU_CAP_XFORM) || src->depth != FBMODE_BPP16 ||
+		dst->depth != FBMODE_BPP16 || src->w > XFORM_SRC_MAX || src->h > XFORM_SRC_MAX ||
+		rot < XFORM_ROT0 || rot > XFORM_ROT270)
+		return -1;
+	if (sw <= 0 || sh <= 0 || dw <= 0 || dh <= 0)
+		return 0;
+	du = ((uint32_t)sw << 16) / ((rot & 1) ? dh : dw);
+	dv = ((uint32_t)sh << 16) / ((rot & 1) ? dw : dh);
+	/* at the center of the first target pixel, from the far end when reversed */
+	u = (rot <= XFORM_ROT90) ? ((uint32_t)sx << 16) + du / 2 : ((uint32_t)(sx + sw) << 16) - du / 2;
+	v = (rot == XFORM_ROT0 || rot == XFORM_ROT270) ? ((uint32_t)sy << 16) + dv / 2
+												   : ((uint32_t)(sy + sh) << 16) - dv / 2;
+	lcd_regs->xfdudx = dir[rot][0] * du;
+	lcd_regs->xfdvdx = dir[rot][1] * dv;
+	lcd_regs->xfdudy = dir[rot][2] * du;
+	lcd_regs->xfdvdy = dir[rot][3] * dv;
+	/* moved to target 0, 0, modulo 2^32 like the GPU walks it back */
+	lcd_regs->xfu0 = u - dir[rot][0] * du * dx - dir[rot][2] * du * dy;
+	lcd_regs->xfv0 = v - dir[rot][1] * dv * dx - dir[rot][3] * dv * dy;
+	lcd_regs->xfsrcmax = XFORM_SRCMAX(src->w - 1, src->h - 1);
+	lcd_regs->x0y0 = (dx & 0xffff) | ((dy & 0xffff) << 16);
+	lcd_regs->x1y1 = ((dx + dw - 1) & 0xffff) | (((dy + dh - 1) & 0xffff) << 16);
+	return surface_exec(GPU_BLIT_XFORM, dst, src);
+}
@@ -0,0 +1,53 @@
+#ifndef __FB_SURFACE_H__
+#define __FB_SURFACE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hwdefs.h"
+#include "fb_console.h"
+
+/*
+ * Off-screen surfaces for the GPU: any width and height at any draw depth,
+ * lines packed at a stride of whole PSRAM bursts. They are handed out
+ * first-fit from the PSRAM after the console (SURF_HEAP_ADDR..SURF_HEAP_END)
+ * in SURF_ALIGN steps, which suits every burst length. surface_heap_alloc
+ * hands out plain PSRAM from the same heap, like GPU span lists.
+ */
+#define SURF_ALIGN		 256
+#define SURF_HEAP_ADDR	 ((FBCON_TEXT_END + SURF_ALIGN - 1) & ~(SURF_ALIGN - 1))
+#define SURF_HEAP_END	 LCD_SPAREEND
+#define SURF_MAX_REGIONS 64
+
+/* clockwise rotations of surface_blit_scaled */
+#define XFORM_ROT0	 0
+#define XFORM_ROT90	 1
+#define XFORM_ROT180 2
+#define XFORM_ROT270 3
+
+#define XFORM_SRC_MAX 2048
+
+typedef struct {
+	uint32_t addr;
+	uint16_t w, h;
+	uint16_t stride; /* bytes per line */
+	uint8_t	 depth;	 /* FBMODE_BPP16/8/4 */
+} FB_SURFACE;
+
+int		 surface_stride(int w, int depth);
+int		 surface_alloc(FB_SURFACE *s, int w, int h, int depth);
+void	 surface_free(FB_SURFACE *s);
+void	 surface_screen(FB_SURFACE *s, uint32_t fbaddr);
+uint32_t surface_heap_alloc(uint32_t size);
+void	 surface_heap_free(uint32_t addr);
+uint32_t surface_heap_info(uint32_t *largest, int *used);
+void	 surface_heap_dump(void);
+
+int surface_clear(const FB_SURFACE *s, uint32_t argb);
+int surface_fill_rect(const FB_SURFACE *s, int x, int y, int w, int h, uint32_t argb);
+int surface_blit(const FB_SURFACE *src, int sx, int sy, const FB_SURFACE *dst, int dx, int dy,
+				 int w, int h);
+int surface_blit_scaled(const FB_SURFACE *src, int sx, int sy, int sw, int sh,
+						const FB_SURFACE *dst, int dx, int dy, int dw, int dh, int rot);
+
+#endif /* __FB_SURFACE_H__ */
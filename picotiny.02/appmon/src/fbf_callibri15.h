@@ -0,0 +1,165 @@
+/*
+ * fbf_callibri15: generated by fontconv from Callibri15.h
+ * 1bpp, height 15, max width 12, chars 0x20-0x7f, 2389 bytes
+ * Do not edit, regenerate with sw/fontconv instead.
+ */
+
+#ifndef _FBF_CALLIBRI15_H
+#define _FBF_CALLIBRI15_H
+
+#include "fbfont.h"
+
+FBFONTDECL(fbf_callibri15) = {
+	0x50, 0x54, 0x46, 0x31, 0x01, 0x0f, 0x0c, 0x20, 0x60, 0x00, 0x01, 0x00, 0x55, 0x09, 0x00, 0x00,
+	0x10, 0x03, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0x1f, 0x03, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+	0x2e, 0x03, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00, 0x3d, 0x03, 0x00, 0x00, 0x08, 0x09, 0x01, 0x00,
+	0x4c, 0x03, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0x5b, 0x03, 0x00, 0x00, 0x0a, 0x0b, 0x02, 0x00,
+	0x79, 0x03, 0x00, 0x00, 0x09, 0x0a, 0x02, 0x00, 0x97, 0x03, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+	0xa6, 0x03, 0x00, 0x00, 0x03, 0x04, 0x01, 0x00, 0xb5, 0x03, 0x00, 0x00, 0x03, 0x04, 0x01, 0x00,
+	0xc4, 0x03, 0x00, 0x00, 0x05, 0x06, 0x01, 0x00, 0xd3, 0x03, 0x00, 0x00, 0x07, 0x08, 0x01, 0x00,
+	0xe2, 0x03, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0xf1, 0x03, 0x00, 0x00, 0x03, 0x04, 0x01, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00,
+	0x1e, 0x04, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0x2d, 0x04, 0x00, 0x00, 0x05, 0x06, 0x01, 0x00,
+	0x3c, 0x04, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0x4b, 0x04, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00,
+	0x5a, 0x04, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0x69, 0x04, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00,
+	0x78, 0x04, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0x87, 0x04, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00,
+	0x96, 0x04, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0xa5, 0x04, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00,
+	0xb4, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0xc3, 0x04, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00,
+	0xd2, 0x04, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0xe1, 0x04, 0x00, 0x00, 0x07, 0x08, 0x01, 0x00,
+	0xf0, 0x04, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0xff, 0x04, 0x00, 0x00, 0x05, 0x06, 0x01, 0x00,
+	0x0e, 0x05, 0x00, 0x00, 0x0c, 0x0d, 0x02, 0x00, 0x2c, 0x05, 0x00, 0x00, 0x09, 0x0a, 0x02, 0x00,
+	0x4a, 0x05, 0x00, 0x00, 0x07, 0x08, 0x01, 0x00, 0x59, 0x05, 0x00, 0x00, 0x08, 0x09, 0x01, 0x00,
+	0x68, 0x05, 0x00, 0x00, 0x08, 0x09, 0x01, 0x00, 0x77, 0x05, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00,
+	0x86, 0x05, 0x00, 0x00, 0x05, 0x06, 0x01, 0x00, 0x95, 0x05, 0x00, 0x00, 0x08, 0x09, 0x01, 0x00,
+	0xa4, 0x05, 0x00, 0x00, 0x08, 0x09, 0x01, 0x00, 0xb3, 0x05, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+	0xc2, 0x05, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00, 0xd1, 0x05, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00,
+	0xe0, 0x05, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0xef, 0x05, 0x00, 0x00, 0x0b, 0x0c, 0x02, 0x00,
+	0x0d, 0x06, 0x00, 0x00, 0x08, 0x09, 0x01, 0x00, 0x1c, 0x06, 0x00, 0x00, 0x09, 0x0a, 0x02, 0x00,
+	0x3a, 0x06, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0x49, 0x06, 0x00, 0x00, 0x0a, 0x0b, 0x02, 0x00,
+	0x67, 0x06, 0x00, 0x00, 0x07, 0x08, 0x01, 0x00, 0x76, 0x06, 0x00, 0x00, 0x05, 0x06, 0x01, 0x00,
+	0x85, 0x06, 0x00, 0x00, 0x07, 0x08, 0x01, 0x00, 0x94, 0x06, 0x00, 0x00, 0x08, 0x09, 0x01, 0x00,
+	0xa3, 0x06, 0x00, 0x00, 0x09, 0x0a, 0x02, 0x00, 0xc1, 0x06, 0x00, 0x00, 0x0b, 0x0c, 0x02, 0x00,
+	0xdf, 0x06, 0x00, 0x00, 0x08, 0x09, 0x01, 0x00, 0xee, 0x06, 0x00, 0x00, 0x07, 0x08, 0x01, 0x00,
+	0xfd, 0x06, 0x00, 0x00, 0x07, 0x08, 0x01, 0x00, 0x0c, 0x07, 0x00, 0x00, 0x03, 0x04, 0x01, 0x00,
+	0x1b, 0x07, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0x2a, 0x07, 0x00, 0x00, 0x03, 0x04, 0x01, 0x00,
+	0x39, 0x07, 0x00, 0x00, 0x07, 0x08, 0x01, 0x00, 0x48, 0x07, 0x00, 0x00, 0x08, 0x09, 0x01, 0x00,
+	0x57, 0x07, 0x00, 0x00, 0x03, 0x04, 0x01, 0x00, 0x66, 0x07, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00,
+	0x75, 0x07, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0x84, 0x07, 0x00, 0x00, 0x05, 0x06, 0x01, 0x00,
+	0x93, 0x07, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0xa2, 0x07, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00,
+	0xb1, 0x07, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00, 0xc0, 0x07, 0x00, 0x00, 0x07, 0x08, 0x01, 0x00,
+	0xcf, 0x07, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0xde, 0x07, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+	0xed, 0x07, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0xfc, 0x07, 0x00, 0x00, 0x05, 0x06, 0x01, 0x00,
+	0x0b, 0x08, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x1a, 0x08, 0x00, 0x00, 0x09, 0x0a, 0x02, 0x00,
+	0x38, 0x08, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0x47, 0x08, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00,
+	0x56, 0x08, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0x65, 0x08, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00,
+	0x74, 0x08, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00, 0x83, 0x08, 0x00, 0x00, 0x05, 0x06, 0x01, 0x00,
+	0x92, 0x08, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00, 0xa1, 0x08, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00,
+	0xb0, 0x08, 0x00, 0x00, 0x05, 0x06, 0x01, 0x00, 0xbf, 0x08, 0x00, 0x00, 0x09, 0x0a, 0x02, 0x00,
+	0xdd, 0x08, 0x00, 0x00, 0x05, 0x06, 0x01, 0x00, 0xec, 0x08, 0x00, 0x00, 0x05, 0x06, 0x01, 0x00,
+	0xfb, 0x08, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00, 0x0a, 0x09, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00,
+	0x19, 0x09, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x28, 0x09, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00,
+	0x37, 0x09, 0x00, 0x00, 0x07, 0x08, 0x01, 0x00, 0x46, 0x09, 0x00, 0x00, 0x08, 0x09, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x90,
+	0x90, 0x90, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+	0x22, 0x22, 0xff, 0x22, 0x44, 0xff, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x10, 0x10, 0x78, 0x84,
+	0x80, 0x80, 0x60, 0x18, 0x04, 0x04, 0x84, 0x78, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61,
+	0x00, 0x91, 0x00, 0x92, 0x00, 0x94, 0x00, 0x64, 0x00, 0x09, 0x80, 0x0a, 0x40, 0x12, 0x40, 0x22,
+	0x40, 0x21, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x44, 0x00, 0x44,
+	0x00, 0x48, 0x00, 0x30, 0x00, 0x51, 0x00, 0x89, 0x00, 0x85, 0x00, 0x82, 0x00, 0x85, 0x00, 0x78,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x40, 0x40, 0x20, 0x00, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x40, 0x40, 0x80, 0x00, 0x20, 0xa8, 0x70, 0x70, 0xa8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0xfe, 0x10, 0x10, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00,
+	0x78, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x60, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x84,
+	0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x40, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x84, 0x04,
+	0x04, 0x78, 0x04, 0x04, 0x04, 0x84, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x28, 0x28,
+	0x48, 0x48, 0x88, 0xfc, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x40, 0x40, 0x40, 0x78,
+	0x04, 0x04, 0x04, 0x84, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x80, 0x80, 0xb8, 0xc4,
+	0x84, 0x84, 0x84, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10,
+	0x20, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x84, 0x84, 0x84, 0x78, 0x84, 0x84, 0x84,
+	0x84, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x84, 0x84, 0x84, 0x8c, 0x74, 0x04, 0x04, 0x08,
+	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x18, 0x60, 0x80, 0x60, 0x18, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x18, 0x04, 0x18, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x70, 0x88, 0x08, 0x08, 0x08, 0x30, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0xc0, 0x30, 0x20, 0x40, 0x10, 0x46, 0x90, 0x89, 0x90, 0x90, 0x90, 0x91, 0x10,
+	0x93, 0x20, 0x8c, 0xc0, 0x40, 0x00, 0x60, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x08, 0x00, 0x14, 0x00, 0x14, 0x00, 0x22, 0x00, 0x22, 0x00, 0x7f, 0x00, 0x41, 0x00,
+	0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x84, 0x84, 0x84,
+	0xf8, 0x84, 0x82, 0x82, 0x82, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x41, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x80, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x82, 0x81, 0x81, 0x81, 0x81,
+	0x81, 0x81, 0x82, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x80, 0x80, 0x80, 0xf8, 0x80, 0x80,
+	0x80, 0x80, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x80, 0x80, 0xf8, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x41, 0x80, 0x80, 0x80, 0x8f, 0x81, 0x81, 0x41,
+	0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 0x81, 0x81, 0xff, 0x81, 0x81, 0x81, 0x81, 0x81,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xe0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x84, 0x88, 0x90, 0xa0, 0xc0, 0xa0, 0x90, 0x90, 0x88, 0x84, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xc0, 0x60, 0xc0, 0x60, 0xa0, 0xa0, 0xa0, 0xa0, 0x91, 0x20, 0x91, 0x20, 0x8a,
+	0x20, 0x8a, 0x20, 0x84, 0x20, 0x84, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1,
+	0xa1, 0xa1, 0x91, 0x91, 0x89, 0x89, 0x85, 0x85, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x41, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x41, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x84, 0x84, 0x84,
+	0x84, 0xf8, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x41,
+	0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x41, 0x00, 0x3f,
+	0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x84, 0x84, 0x84, 0x84, 0xf8, 0x88,
+	0x84, 0x84, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0x80, 0x80, 0x60, 0x10, 0x08, 0x08,
+	0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x41, 0x00, 0x41, 0x00, 0x22,
+	0x00, 0x22, 0x00, 0x14, 0x00, 0x14, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20, 0x4a, 0x40, 0x4a, 0x40, 0x4a,
+	0x40, 0x51, 0x40, 0x31, 0x80, 0x20, 0x80, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x81, 0x42, 0x24, 0x24, 0x18, 0x18, 0x24, 0x24, 0x42, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x82, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
+	0x02, 0x04, 0x08, 0x10, 0x10, 0x20, 0x40, 0x80, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x80, 0x80,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xe0, 0x00, 0x80, 0x80, 0x40, 0x40,
+	0x20, 0x20, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x00, 0x00, 0xe0, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x00, 0x00, 0x10, 0x28, 0x28, 0x44, 0x44,
+	0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x80, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x84, 0x04, 0x7c, 0x84,
+	0x8c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xb8, 0xc4, 0x84, 0x84, 0x84, 0xc4,
+	0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0x80, 0x80, 0x80, 0x88, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x74, 0x8c, 0x84, 0x84, 0x84, 0x8c, 0x74, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x84, 0x84, 0xfc, 0x80, 0x80, 0x7c, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x40, 0x40, 0x40, 0xf0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x84, 0x84, 0x84, 0x78, 0x80, 0x7c, 0x82, 0x82, 0x7c, 0x00,
+	0x80, 0x80, 0x80, 0x80, 0xb8, 0xc4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x00, 0x80, 0x80, 0x80,
+	0x80, 0x88, 0x90, 0xa0, 0xc0, 0xa0, 0x90, 0x88, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xb3, 0x00, 0xcc, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80,
+	0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xc4, 0x84,
+	0x84, 0x84, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x84, 0x84, 0x84,
+	0x84, 0x84, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xc4, 0x84, 0x84, 0x84,
+	0xc4, 0xb8, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x8c, 0x84, 0x84, 0x84, 0x8c,
+	0x74, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x80, 0x80, 0x70, 0x08, 0x08, 0xf0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0xf0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x30, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8c, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x50, 0x50, 0x50, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x88, 0x80, 0x55, 0x00, 0x55,
+	0x00, 0x55, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x88, 0x50, 0x50, 0x20, 0x50, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x88, 0x88, 0x50, 0x50, 0x50, 0x20, 0x20, 0x20, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0x10, 0x20, 0x40, 0x40, 0x80, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x30, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00, 0x00, 0x00, 0x62, 0x92, 0x8c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x81, 0xb9, 0x85, 0x85, 0x99, 0x81, 0x91,
+	0x81, 0xff, 0x00, 0x00, 0x00,
+};
+
+#endif
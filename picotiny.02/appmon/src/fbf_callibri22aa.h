@@ -0,0 +1,428 @@
+/*
+ * fbf_callibri22aa: generated by fontconv from Callibri15.h
+ * 2bpp, height 23, max width 18, chars 0x20-0x7f, 6603 bytes
+ * Do not edit, regenerate with sw/fontconv instead.
+ */
+
+#ifndef _FBF_CALLIBRI22AA_H
+#define _FBF_CALLIBRI22AA_H
+
+#include "fbfont.h"
+
+FBFONTDECL(fbf_callibri22aa) = {
+	0x50, 0x54, 0x46, 0x31, 0x02, 0x17, 0x12, 0x20, 0x60, 0x00, 0x01, 0x00, 0xcb, 0x19, 0x00, 0x00,
+	0x10, 0x03, 0x00, 0x00, 0x03, 0x05, 0x01, 0x00, 0x27, 0x03, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00,
+	0x3e, 0x03, 0x00, 0x00, 0x06, 0x08, 0x02, 0x00, 0x6c, 0x03, 0x00, 0x00, 0x0c, 0x0e, 0x03, 0x00,
+	0xb1, 0x03, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0xf6, 0x03, 0x00, 0x00, 0x0f, 0x11, 0x04, 0x00,
+	0x52, 0x04, 0x00, 0x00, 0x0e, 0x0f, 0x04, 0x00, 0xae, 0x04, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00,
+	0xc5, 0x04, 0x00, 0x00, 0x05, 0x06, 0x02, 0x00, 0xf3, 0x04, 0x00, 0x00, 0x05, 0x06, 0x02, 0x00,
+	0x21, 0x05, 0x00, 0x00, 0x08, 0x09, 0x02, 0x00, 0x4f, 0x05, 0x00, 0x00, 0x0b, 0x0c, 0x03, 0x00,
+	0x94, 0x05, 0x00, 0x00, 0x03, 0x05, 0x01, 0x00, 0xab, 0x05, 0x00, 0x00, 0x05, 0x06, 0x02, 0x00,
+	0xd9, 0x05, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0xf0, 0x05, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00,
+	0x35, 0x06, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0x7a, 0x06, 0x00, 0x00, 0x08, 0x09, 0x02, 0x00,
+	0xa8, 0x06, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0xed, 0x06, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00,
+	0x32, 0x07, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0x77, 0x07, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00,
+	0xbc, 0x07, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0x01, 0x08, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00,
+	0x46, 0x08, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0x8b, 0x08, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00,
+	0xd0, 0x08, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0xe7, 0x08, 0x00, 0x00, 0x03, 0x05, 0x01, 0x00,
+	0xfe, 0x08, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0x43, 0x09, 0x00, 0x00, 0x0b, 0x0c, 0x03, 0x00,
+	0x88, 0x09, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0xcd, 0x09, 0x00, 0x00, 0x08, 0x09, 0x02, 0x00,
+	0xfb, 0x09, 0x00, 0x00, 0x12, 0x14, 0x05, 0x00, 0x6e, 0x0a, 0x00, 0x00, 0x0e, 0x0f, 0x04, 0x00,
+	0xca, 0x0a, 0x00, 0x00, 0x0b, 0x0c, 0x03, 0x00, 0x0f, 0x0b, 0x00, 0x00, 0x0c, 0x0e, 0x03, 0x00,
+	0x54, 0x0b, 0x00, 0x00, 0x0c, 0x0e, 0x03, 0x00, 0x99, 0x0b, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00,
+	0xde, 0x0b, 0x00, 0x00, 0x08, 0x09, 0x02, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x0e, 0x03, 0x00,
+	0x51, 0x0c, 0x00, 0x00, 0x0c, 0x0e, 0x03, 0x00, 0x96, 0x0c, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00,
+	0xad, 0x0c, 0x00, 0x00, 0x06, 0x08, 0x02, 0x00, 0xdb, 0x0c, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00,
+	0x20, 0x0d, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0x65, 0x0d, 0x00, 0x00, 0x11, 0x12, 0x05, 0x00,
+	0xd8, 0x0d, 0x00, 0x00, 0x0c, 0x0e, 0x03, 0x00, 0x1d, 0x0e, 0x00, 0x00, 0x0e, 0x0f, 0x04, 0x00,
+	0x79, 0x0e, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0xbe, 0x0e, 0x00, 0x00, 0x0f, 0x11, 0x04, 0x00,
+	0x1a, 0x0f, 0x00, 0x00, 0x0b, 0x0c, 0x03, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x08, 0x09, 0x02, 0x00,
+	0x8d, 0x0f, 0x00, 0x00, 0x0b, 0x0c, 0x03, 0x00, 0xd2, 0x0f, 0x00, 0x00, 0x0c, 0x0e, 0x03, 0x00,
+	0x17, 0x10, 0x00, 0x00, 0x0e, 0x0f, 0x04, 0x00, 0x73, 0x10, 0x00, 0x00, 0x11, 0x12, 0x05, 0x00,
+	0xe6, 0x10, 0x00, 0x00, 0x0c, 0x0e, 0x03, 0x00, 0x2b, 0x11, 0x00, 0x00, 0x0b, 0x0c, 0x03, 0x00,
+	0x70, 0x11, 0x00, 0x00, 0x0b, 0x0c, 0x03, 0x00, 0xb5, 0x11, 0x00, 0x00, 0x05, 0x06, 0x02, 0x00,
+	0xe3, 0x11, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0x28, 0x12, 0x00, 0x00, 0x05, 0x06, 0x02, 0x00,
+	0x56, 0x12, 0x00, 0x00, 0x0b, 0x0c, 0x03, 0x00, 0x9b, 0x12, 0x00, 0x00, 0x0c, 0x0e, 0x03, 0x00,
+	0xe0, 0x12, 0x00, 0x00, 0x05, 0x06, 0x02, 0x00, 0x0e, 0x13, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00,
+	0x53, 0x13, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0x98, 0x13, 0x00, 0x00, 0x08, 0x09, 0x02, 0x00,
+	0xc6, 0x13, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0x0b, 0x14, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00,
+	0x50, 0x14, 0x00, 0x00, 0x06, 0x08, 0x02, 0x00, 0x7e, 0x14, 0x00, 0x00, 0x0b, 0x0c, 0x03, 0x00,
+	0xc3, 0x14, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0x08, 0x15, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00,
+	0x1f, 0x15, 0x00, 0x00, 0x03, 0x05, 0x01, 0x00, 0x36, 0x15, 0x00, 0x00, 0x08, 0x09, 0x02, 0x00,
+	0x64, 0x15, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0x7b, 0x15, 0x00, 0x00, 0x0e, 0x0f, 0x04, 0x00,
+	0xd7, 0x15, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0x1c, 0x16, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00,
+	0x61, 0x16, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00, 0xa6, 0x16, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00,
+	0xeb, 0x16, 0x00, 0x00, 0x06, 0x08, 0x02, 0x00, 0x19, 0x17, 0x00, 0x00, 0x08, 0x09, 0x02, 0x00,
+	0x47, 0x17, 0x00, 0x00, 0x06, 0x08, 0x02, 0x00, 0x75, 0x17, 0x00, 0x00, 0x09, 0x0b, 0x03, 0x00,
+	0xba, 0x17, 0x00, 0x00, 0x08, 0x09, 0x02, 0x00, 0xe8, 0x17, 0x00, 0x00, 0x0e, 0x0f, 0x04, 0x00,
+	0x44, 0x18, 0x00, 0x00, 0x08, 0x09, 0x02, 0x00, 0x72, 0x18, 0x00, 0x00, 0x08, 0x09, 0x02, 0x00,
+	0xa0, 0x18, 0x00, 0x00, 0x06, 0x08, 0x02, 0x00, 0xce, 0x18, 0x00, 0x00, 0x06, 0x08, 0x02, 0x00,
+	0xfc, 0x18, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0x13, 0x19, 0x00, 0x00, 0x06, 0x08, 0x02, 0x00,
+	0x41, 0x19, 0x00, 0x00, 0x0b, 0x0c, 0x03, 0x00, 0x86, 0x19, 0x00, 0x00, 0x0c, 0x0e, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0,
+	0xd0, 0xd0, 0xd0, 0xd0, 0x50, 0x00, 0xd0, 0xd0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x50, 0xd0, 0x70, 0xd0, 0x70, 0xd0, 0x70, 0xd0, 0x70, 0xd0, 0x70, 0x50, 0x50, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x34, 0x03, 0x40, 0x34, 0x03, 0x40, 0x34, 0x03, 0x40,
+	0x34, 0x57, 0x95, 0x79, 0xff, 0xff, 0xff, 0x03, 0x40, 0x34, 0x15, 0x41, 0x54, 0x1c, 0x01, 0xc0,
+	0xff, 0xff, 0xff, 0x6d, 0x56, 0xd5, 0x1c, 0x01, 0xc0, 0x1c, 0x01, 0xc0, 0x1c, 0x01, 0xc0, 0x1c,
+	0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xfd, 0x00, 0x55, 0x55, 0x40,
+	0xd0, 0x01, 0xc0, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x1f, 0x40, 0x00, 0x15,
+	0x55, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0xd0, 0x01,
+	0xc0, 0x55, 0x55, 0x40, 0x1f, 0xfd, 0x00, 0x03, 0x40, 0x00, 0x03, 0x40, 0x00, 0x03, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x40, 0x07, 0x00, 0x55, 0x50, 0x07, 0x00, 0xd0, 0x70, 0x07, 0x00, 0xd0, 0x70,
+	0x34, 0x00, 0xd0, 0x71, 0x54, 0x00, 0xd0, 0x71, 0xc0, 0x00, 0x1f, 0x41, 0xc0, 0x00, 0x15, 0x45,
+	0x45, 0x50, 0x00, 0x0d, 0x07, 0xd0, 0x00, 0x0d, 0x34, 0x1c, 0x00, 0x55, 0x34, 0x1c, 0x00, 0x70,
+	0x34, 0x1c, 0x03, 0x40, 0x34, 0x1c, 0x03, 0x40, 0x15, 0x54, 0x03, 0x40, 0x07, 0xd0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x03, 0xfd, 0x00, 0x00, 0x1c, 0x01,
+	0xc0, 0x00, 0x1c, 0x01, 0xc0, 0x00, 0x1c, 0x01, 0xc0, 0x00, 0x1c, 0x0d, 0x00, 0x00, 0x15, 0x55,
+	0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x1c, 0x70, 0x07, 0x00, 0x54, 0x55, 0x07, 0x00, 0xd0, 0x0d,
+	0x07, 0x00, 0xd0, 0x01, 0xc7, 0x00, 0xd0, 0x01, 0x55, 0x00, 0xd0, 0x00, 0x34, 0x00, 0xd0, 0x01,
+	0xc7, 0x00, 0x55, 0x55, 0x45, 0x50, 0x1f, 0xfd, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+	0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x03, 0x40, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
+	0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+	0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x03,
+	0x40, 0x01, 0x40, 0x00, 0x00, 0x50, 0x00, 0xd0, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x03,
+	0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03,
+	0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0xd0, 0x00, 0x50,
+	0x00, 0x00, 0x00, 0x01, 0x40, 0x03, 0x40, 0xd3, 0x4d, 0x57, 0x95, 0x1f, 0xf0, 0x1f, 0xf0, 0x57,
+	0x95, 0xd3, 0x4d, 0x03, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x55, 0xb5, 0x54,
+	0xff, 0xff, 0xf4, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x54, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0x40, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xd0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x05, 0x40, 0x00,
+	0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x55, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x01, 0x50,
+	0x00, 0x03, 0x40, 0x00, 0x03, 0x40, 0x00, 0x03, 0x40, 0x00, 0x03, 0x40, 0x00, 0x1c, 0x00, 0x00,
+	0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfd,
+	0x00, 0x55, 0x55, 0x40, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0,
+	0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0,
+	0x01, 0xc0, 0xd0, 0x01, 0xc0, 0x55, 0x55, 0x40, 0x1f, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x40, 0x17, 0x40, 0x1f, 0x40, 0xd3, 0x40, 0x53, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40,
+	0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x57, 0x95, 0xff, 0xfd, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1f, 0xfd, 0x00, 0x55, 0x55, 0x40, 0xd0, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0,
+	0x00, 0x01, 0xc0, 0x00, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x70, 0x00, 0x01,
+	0x50, 0x00, 0x03, 0x40, 0x00, 0x1c, 0x00, 0x00, 0x6d, 0x55, 0x40, 0xff, 0xff, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfd, 0x00, 0x55, 0x55, 0x40, 0xd0, 0x01, 0xc0, 0x00,
+	0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x1f, 0xfd, 0x00, 0x15, 0x55, 0x40, 0x00, 0x01,
+	0xc0, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0x55, 0x55, 0x40,
+	0x1f, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x7d,
+	0x00, 0x00, 0x7d, 0x00, 0x03, 0x4d, 0x00, 0x03, 0x4d, 0x00, 0x03, 0x4d, 0x00, 0x1c, 0x0d, 0x00,
+	0x1c, 0x0d, 0x00, 0x1c, 0x0d, 0x00, 0xd0, 0x0d, 0x00, 0xe5, 0x5e, 0x40, 0xff, 0xff, 0xc0, 0x00,
+	0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0xff, 0xc0, 0x1d, 0x55, 0x40, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c,
+	0x00, 0x00, 0x1f, 0xfd, 0x00, 0x15, 0x55, 0x40, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x01,
+	0xc0, 0x00, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0x55, 0x55, 0x40, 0x1f, 0xfd, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x15, 0x55, 0x40, 0x1c, 0x00, 0x00, 0xd0, 0x00,
+	0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd3, 0xfd, 0x00, 0xe5, 0x55, 0x40, 0xfc, 0x01, 0xc0,
+	0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0x55, 0x55, 0x40, 0x1f,
+	0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x55, 0x56, 0xc0,
+	0x00, 0x01, 0xc0, 0x00, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x70, 0x00, 0x00,
+	0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x01, 0x50, 0x00, 0x03, 0x40, 0x00, 0x03, 0x40,
+	0x00, 0x15, 0x40, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+	0xfd, 0x00, 0x55, 0x55, 0x40, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01,
+	0xc0, 0x1f, 0xfd, 0x00, 0x55, 0x55, 0x40, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0,
+	0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0x55, 0x55, 0x40, 0x1f, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0xfd, 0x00, 0x55, 0x55, 0x40, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0,
+	0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x0f, 0xc0, 0x55, 0x56, 0xc0, 0x1f, 0xf1, 0xc0, 0x00,
+	0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x0d, 0x00, 0x55, 0x55, 0x00, 0xff, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xd0, 0xd0, 0x50, 0x00, 0x00, 0x00, 0x00, 0xd0,
+	0xd0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1c,
+	0x1c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x54, 0xd0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0xc0, 0x00, 0x55, 0x40, 0x00, 0x7d, 0x00, 0x1f, 0x40, 0x00, 0x55, 0x40, 0x00, 0xd0,
+	0x00, 0x00, 0x1f, 0x40, 0x00, 0x15, 0x55, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x01,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0xff, 0xff, 0xf4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf4, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x55, 0x40, 0x00,
+	0x1f, 0x40, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x55, 0x40, 0x00, 0x01, 0xc0, 0x00, 0x7d, 0x00, 0x15,
+	0x55, 0x00, 0x1f, 0x40, 0x00, 0xd0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+	0x50, 0x1f, 0xf0, 0xd0, 0x0d, 0x50, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x03,
+	0xf0, 0x03, 0x90, 0x03, 0x40, 0x03, 0x40, 0x01, 0x40, 0x00, 0x00, 0x03, 0x40, 0x03, 0x40, 0x03,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x01,
+	0x55, 0x55, 0x55, 0x40, 0x03, 0xf0, 0x00, 0x03, 0x40, 0x1c, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x01,
+	0x54, 0x50, 0x70, 0x1c, 0x01, 0xf4, 0xd0, 0x70, 0xd0, 0x0d, 0x07, 0xd0, 0x70, 0xd0, 0x55, 0x05,
+	0xd0, 0x70, 0xd0, 0x70, 0x00, 0xd0, 0x70, 0xd0, 0x70, 0x07, 0x00, 0x70, 0xd0, 0x70, 0x1b, 0x01,
+	0x50, 0xd0, 0x70, 0x3f, 0x03, 0x40, 0xd0, 0x0f, 0xc0, 0xfc, 0x00, 0x54, 0x05, 0x40, 0x54, 0x00,
+	0x1c, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x40, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x50, 0x00, 0x00,
+	0x7f, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d,
+	0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x71, 0xc0, 0x00, 0x00, 0x71, 0xc0, 0x00, 0x00, 0x71,
+	0xc0, 0x00, 0x03, 0x40, 0x34, 0x00, 0x03, 0x40, 0x34, 0x00, 0x03, 0x40, 0x34, 0x00, 0x1f, 0xff,
+	0xff, 0x00, 0x1d, 0x55, 0x5b, 0x00, 0x1c, 0x00, 0x07, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00,
+	0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xe5, 0x55, 0x40, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0,
+	0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xff, 0xfd, 0x00, 0xe5, 0x55, 0x40, 0xd0, 0x01, 0xc0, 0xd0, 0x00,
+	0x34, 0xd0, 0x00, 0x34, 0xd0, 0x00, 0x34, 0xd0, 0x00, 0x34, 0xe5, 0x55, 0x54, 0xff, 0xff, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf4, 0x15, 0x55, 0x55, 0x1c, 0x00,
+	0x07, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00,
+	0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x1c, 0x00, 0x07, 0x15,
+	0x55, 0x55, 0x03, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0,
+	0xe5, 0x55, 0x54, 0xd0, 0x00, 0x34, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0,
+	0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00,
+	0x07, 0xd0, 0x00, 0x34, 0xe5, 0x55, 0x54, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xc0, 0xe5, 0x55, 0x40, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00,
+	0x00, 0xd0, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xe5, 0x55, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00,
+	0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xe5, 0x55, 0x40, 0xff, 0xff, 0xc0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfd, 0xe5, 0x55, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00,
+	0xff, 0xfd, 0xe5, 0x55, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00,
+	0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf4, 0x15, 0x55, 0x55, 0x1c, 0x00, 0x07, 0xd0, 0x00,
+	0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x05, 0x55, 0xd0, 0x0f, 0xff,
+	0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0x1c, 0x00, 0x07, 0x15, 0x55, 0x55, 0x03,
+	0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07,
+	0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xe5,
+	0x55, 0x5b, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00,
+	0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0,
+	0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
+	0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x55, 0x50, 0xff,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xd0, 0x01, 0xc0, 0xd0, 0x05, 0x40, 0xd0, 0x0d, 0x00, 0xd0, 0x70, 0x00,
+	0xd1, 0x50, 0x00, 0xd3, 0x40, 0x00, 0xfc, 0x00, 0x00, 0xe5, 0x40, 0x00, 0xd3, 0x40, 0x00, 0xd0,
+	0x70, 0x00, 0xd0, 0x70, 0x00, 0xd0, 0x70, 0x00, 0xd0, 0x0d, 0x00, 0xd0, 0x05, 0x40, 0xd0, 0x01,
+	0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0,
+	0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00,
+	0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00,
+	0xe5, 0x55, 0x40, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x1f, 0x40, 0xfc, 0x00, 0x00, 0x1f, 0x40, 0xfc, 0x00,
+	0x00, 0x1f, 0x40, 0xd3, 0x40, 0x00, 0xd3, 0x40, 0xd3, 0x40, 0x00, 0xd3, 0x40, 0xd3, 0x40, 0x00,
+	0xd3, 0x40, 0xd0, 0x70, 0x07, 0x03, 0x40, 0xd0, 0x70, 0x07, 0x03, 0x40, 0xd0, 0x70, 0x07, 0x03,
+	0x40, 0xd0, 0x0d, 0x34, 0x03, 0x40, 0xd0, 0x0d, 0x34, 0x03, 0x40, 0xd0, 0x0d, 0x34, 0x03, 0x40,
+	0xd0, 0x01, 0xc0, 0x03, 0x40, 0xd0, 0x01, 0xc0, 0x03, 0x40, 0xd0, 0x01, 0xc0, 0x03, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xfc, 0x00, 0x07, 0xe5, 0x40, 0x07, 0xd3, 0x40, 0x07, 0xd3, 0x40, 0x07, 0xd1, 0x50, 0x07,
+	0xd0, 0x70, 0x07, 0xd0, 0x70, 0x07, 0xd0, 0x55, 0x07, 0xd0, 0x0d, 0x07, 0xd0, 0x0d, 0x07, 0xd0,
+	0x05, 0x47, 0xd0, 0x01, 0xc7, 0xd0, 0x01, 0xc7, 0xd0, 0x01, 0x5b, 0xd0, 0x00, 0x3f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf4, 0x00, 0x15, 0x55, 0x55,
+	0x00, 0x1c, 0x00, 0x07, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00, 0x00,
+	0xd0, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00, 0x00,
+	0xd0, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0x1c, 0x00, 0x07, 0x00, 0x15, 0x55, 0x55,
+	0x00, 0x03, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xfd, 0x00, 0xe5, 0x55, 0x40, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01,
+	0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xe5, 0x55, 0x40, 0xff, 0xfd, 0x00, 0xd0, 0x00, 0x00,
+	0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf4, 0x00, 0x15, 0x55,
+	0x55, 0x00, 0x1c, 0x00, 0x07, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00,
+	0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00,
+	0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0x1c, 0x00, 0x07, 0x00, 0x15, 0x55,
+	0x5b, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xe5, 0x55, 0x40, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0,
+	0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xe5, 0x55, 0x40, 0xff, 0xfd, 0x00, 0xd0, 0x0d,
+	0x00, 0xd0, 0x05, 0x40, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0x54, 0xd0, 0x00, 0x34,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x55, 0x55, 0xd0, 0x0d, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+	0x00, 0x1f, 0x40, 0x15, 0x50, 0x00, 0x70, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0xd0, 0x0d, 0x55,
+	0x55, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf4, 0x55, 0xb5, 0x54, 0x00, 0x70, 0x00, 0x00,
+	0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
+	0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x07, 0xd0, 0x00,
+	0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07,
+	0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x00, 0x07, 0x1c,
+	0x00, 0x34, 0x15, 0x55, 0x54, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0x1c,
+	0x00, 0x07, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x03, 0x40, 0x34, 0x00, 0x03,
+	0x40, 0x34, 0x00, 0x03, 0x40, 0x34, 0x00, 0x00, 0x71, 0xc0, 0x00, 0x00, 0x71, 0xc0, 0x00, 0x00,
+	0x71, 0xc0, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xd0, 0x01, 0xc0, 0x03, 0x40, 0xd0, 0x01, 0xc0, 0x03, 0x40, 0xd0, 0x01, 0xc0, 0x03,
+	0x40, 0xd0, 0x01, 0xc0, 0x03, 0x40, 0x54, 0x05, 0x54, 0x15, 0x40, 0x1c, 0x0d, 0x34, 0x1c, 0x00,
+	0x1c, 0x0d, 0x34, 0x1c, 0x00, 0x1c, 0x0d, 0x34, 0x1c, 0x00, 0x1c, 0x0d, 0x34, 0x1c, 0x00, 0x1c,
+	0x70, 0x07, 0x1c, 0x00, 0x15, 0xb0, 0x07, 0x54, 0x00, 0x03, 0xf0, 0x07, 0xd0, 0x00, 0x03, 0x40,
+	0x00, 0xd0, 0x00, 0x03, 0x40, 0x00, 0xd0, 0x00, 0x03, 0x40, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+	0x00, 0x07, 0x54, 0x00, 0x15, 0x1c, 0x00, 0x34, 0x03, 0x41, 0xc0, 0x03, 0x41, 0xc0, 0x03, 0x41,
+	0xc0, 0x00, 0x7d, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x7d, 0x00, 0x03, 0x41, 0xc0, 0x03, 0x41, 0xc0,
+	0x03, 0x41, 0xc0, 0x1c, 0x00, 0x34, 0x54, 0x00, 0x15, 0xd0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x34, 0x54, 0x01, 0x54, 0x1c, 0x01, 0xc0, 0x1c, 0x01, 0xc0,
+	0x15, 0x45, 0x40, 0x03, 0x4d, 0x00, 0x03, 0x4d, 0x00, 0x01, 0x55, 0x00, 0x00, 0x70, 0x00, 0x00,
+	0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf4, 0x55, 0x55, 0x74, 0x00,
+	0x00, 0x34, 0x00, 0x01, 0xc0, 0x00, 0x05, 0x40, 0x00, 0x0d, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x70, 0x00, 0x03, 0x40, 0x00, 0x15, 0x40, 0x00, 0x1c, 0x00, 0x00, 0xd0, 0x00, 0x00,
+	0xe5, 0x55, 0x54, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0xff, 0x40, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+	0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+	0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xff,
+	0x40, 0x55, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x54,
+	0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x15, 0x40, 0x00, 0x03, 0x40, 0x00, 0x03, 0x40,
+	0x00, 0x01, 0x50, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
+	0x00, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00,
+	0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0xff, 0x40, 0x03, 0x40,
+	0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40,
+	0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40,
+	0x03, 0x40, 0xff, 0x40, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x70, 0x00, 0x01, 0x55, 0x00, 0x03, 0x4d, 0x00, 0x03, 0x4d, 0x00, 0x15, 0x45, 0x40, 0x1c, 0x01,
+	0xc0, 0x1c, 0x01, 0xc0, 0x54, 0x01, 0x54, 0xd0, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55,
+	0x00, 0x00, 0x50, 0x00, 0xd0, 0x00, 0x1c, 0x00, 0x15, 0x40, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x1f, 0xfd, 0x00, 0xd0, 0x01, 0xc0, 0x50, 0x01, 0xc0, 0x00,
+	0x01, 0xc0, 0x1f, 0xff, 0xc0, 0x55, 0x56, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x0f, 0xc0, 0x55, 0x56,
+	0xc0, 0x1f, 0xf1, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0,
+	0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd1, 0x55, 0x00, 0xd3, 0xfd, 0x00, 0xfc, 0x01,
+	0xc0, 0xe4, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0,
+	0xfc, 0x01, 0xc0, 0xe5, 0x55, 0x40, 0xd3, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x1f, 0xf0, 0xd0, 0x0d, 0xd0, 0x05, 0xd0, 0x00,
+	0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x0d, 0x55, 0x55, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xc0, 0x00,
+	0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x15, 0x51, 0xc0, 0x1f, 0xf1,
+	0xc0, 0xd0, 0x0f, 0xc0, 0xd0, 0x06, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0,
+	0xd0, 0x01, 0xc0, 0xd0, 0x0f, 0xc0, 0x55, 0x56, 0xc0, 0x1f, 0xf1, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x15, 0x55, 0x00, 0x1f, 0xfd, 0x00, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xff,
+	0xff, 0xc0, 0xe5, 0x55, 0x40, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x55, 0x55, 0x40, 0x1f, 0xff,
+	0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x50, 0x03, 0xf0, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x6d, 0x50,
+	0xff, 0xf0, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+	0x1c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x1f, 0xff, 0xf4, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0,
+	0x01, 0xc0, 0xd0, 0x01, 0xc0, 0x55, 0x55, 0x40, 0x1f, 0xfd, 0x00, 0xd0, 0x00, 0x00, 0x55, 0x55,
+	0x40, 0x1f, 0xff, 0xc0, 0xd0, 0x00, 0x34, 0xd0, 0x00, 0x34, 0xd0, 0x00, 0x34, 0x1f, 0xff, 0xc0,
+	0x15, 0x55, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0,
+	0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd1, 0x55, 0x00, 0xd3, 0xfd, 0x00, 0xfc, 0x01,
+	0xc0, 0xe4, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0,
+	0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xd0, 0x00, 0x50,
+	0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x14, 0x1c, 0x00, 0x14, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+	0x1c, 0x1c, 0x1c, 0x1c, 0xd0, 0x50, 0x00, 0x00, 0x50, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00,
+	0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x05, 0xd0, 0x0d, 0xd0, 0x70, 0xd1, 0x50, 0xd3, 0x40, 0xfc, 0x00,
+	0xe5, 0x40, 0xd3, 0x40, 0xd0, 0x70, 0xd0, 0x55, 0xd0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0,
+	0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x50, 0x15, 0x00, 0xd3, 0xf0, 0x3f, 0x00, 0xfc,
+	0x0f, 0xc0, 0xd0, 0xe4, 0x0e, 0x40, 0xd0, 0xd0, 0x0d, 0x00, 0xd0, 0xd0, 0x0d, 0x00, 0xd0, 0xd0,
+	0x0d, 0x00, 0xd0, 0xd0, 0x0d, 0x00, 0xd0, 0xd0, 0x0d, 0x00, 0xd0, 0xd0, 0x0d, 0x00, 0xd0, 0xd0,
+	0x0d, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x55, 0x00, 0xd3,
+	0xfd, 0x00, 0xfc, 0x01, 0xc0, 0xe4, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01,
+	0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x15, 0x55, 0x00, 0x1f, 0xfd, 0x00, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0,
+	0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0x55, 0x55, 0x40, 0x1f,
+	0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x55, 0x00, 0xd3, 0xfd, 0x00, 0xfc, 0x01, 0xc0, 0xe4,
+	0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xfc, 0x01,
+	0xc0, 0xe5, 0x55, 0x40, 0xd3, 0xfd, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0x00, 0x00,
+	0xd0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x51, 0x40, 0x1f, 0xf1,
+	0xc0, 0xd0, 0x0f, 0xc0, 0xd0, 0x06, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0,
+	0xd0, 0x01, 0xc0, 0xd0, 0x0f, 0xc0, 0x55, 0x56, 0xc0, 0x1f, 0xf1, 0xc0, 0x00, 0x01, 0xc0, 0x00,
+	0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x50, 0xd3, 0xf0, 0xfc, 0x00, 0xe4,
+	0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x1f, 0xfd, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+	0x00, 0x1f, 0xf0, 0x15, 0x55, 0x00, 0x0d, 0x00, 0x0d, 0x55, 0x55, 0xff, 0xf0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x1c, 0x00, 0x1c, 0x00, 0x6d, 0x50, 0xff, 0xf0, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
+	0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x15, 0x50, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0xd0, 0x01, 0xc0,
+	0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0, 0x01, 0xc0, 0xd0,
+	0x01, 0xc0, 0xd0, 0x0f, 0xc0, 0x55, 0x56, 0xc0, 0x1f, 0xf1, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0xd0, 0x0d, 0xd0, 0x0d, 0x54, 0x55,
+	0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x50, 0xd0, 0x0d, 0x00, 0xd0, 0xd0, 0x0d, 0x00, 0xd0,
+	0x54, 0x55, 0x45, 0x50, 0x1c, 0x71, 0xc7, 0x00, 0x1c, 0x71, 0xc7, 0x00, 0x1c, 0x71, 0xc7, 0x00,
+	0x1c, 0x71, 0xc7, 0x00, 0x03, 0x40, 0x34, 0x00, 0x03, 0x40, 0x34, 0x00, 0x03, 0x40, 0x34, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x50, 0x05, 0xd0, 0x0d, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x03, 0x40, 0x15, 0x50,
+	0x1c, 0x70, 0x1c, 0x70, 0x54, 0x55, 0xd0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x05, 0xd0, 0x0d, 0xd0, 0x0d, 0x54, 0x55, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
+	0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x15, 0x40, 0x1c, 0x00, 0x1c, 0x00, 0x14, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50,
+	0xff, 0xf0, 0x00, 0x70, 0x01, 0x50, 0x03, 0x40, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0xd0, 0x00,
+	0xe5, 0x50, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x50, 0x03, 0xf0, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+	0x1c, 0x00, 0x54, 0x00, 0xd0, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+	0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x03, 0xf0, 0x01, 0x50, 0x00, 0x50, 0xd0, 0xd0,
+	0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0,
+	0xd0, 0xd0, 0x50, 0x00, 0x00, 0x54, 0x00, 0xfc, 0x00, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03,
+	0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x01, 0x50, 0x00, 0x70, 0x03, 0x40, 0x03, 0x40, 0x03,
+	0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0xfc, 0x00, 0x54,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x14,
+	0x1f, 0x40, 0x34, 0xd0, 0x70, 0x34, 0xd0, 0x55, 0x54, 0xd0, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xe5, 0x55, 0x5b, 0xd0, 0x00, 0x07, 0xd3, 0xfd, 0x07, 0xd1, 0x55, 0x47, 0xd0, 0x01,
+	0xc7, 0xd0, 0x01, 0xc7, 0xd0, 0x55, 0x47, 0xd0, 0x7d, 0x07, 0xd0, 0x00, 0x07, 0xd0, 0x50, 0x07,
+	0xd0, 0x70, 0x07, 0xd0, 0x00, 0x07, 0xe5, 0x55, 0x5b, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif
@@ -0,0 +1,242 @@
+/*
+ * fbf_fixed_bold10x15: generated by fontconv from fixed_bold10x15.h
+ * 1bpp, height 15, max width 10, chars 0x20-0x7e, 3626 bytes
+ * Do not edit, regenerate with sw/fontconv instead.
+ */
+
+#ifndef _FBF_FIXED_BOLD10X15_H
+#define _FBF_FIXED_BOLD10X15_H
+
+#include "fbfont.h"
+
+FBFONTDECL(fbf_fixed_bold10x15) = {
+	0x50, 0x54, 0x46, 0x31, 0x01, 0x0f, 0x0a, 0x20, 0x5f, 0x00, 0x00, 0x00, 0x2a, 0x0e, 0x00, 0x00,
+	0x08, 0x03, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x26, 0x03, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x44, 0x03, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x62, 0x03, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x80, 0x03, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x9e, 0x03, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xbc, 0x03, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xda, 0x03, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xf8, 0x03, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x16, 0x04, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x34, 0x04, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x52, 0x04, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x70, 0x04, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x8e, 0x04, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xac, 0x04, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xca, 0x04, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xe8, 0x04, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x06, 0x05, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x24, 0x05, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x42, 0x05, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x60, 0x05, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x7e, 0x05, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x9c, 0x05, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xba, 0x05, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xd8, 0x05, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xf6, 0x05, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x14, 0x06, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x32, 0x06, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x50, 0x06, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x6e, 0x06, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x8c, 0x06, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xaa, 0x06, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xc8, 0x06, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xe6, 0x06, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x04, 0x07, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x22, 0x07, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x40, 0x07, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x5e, 0x07, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x7c, 0x07, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x9a, 0x07, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xb8, 0x07, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xd6, 0x07, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xf4, 0x07, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x12, 0x08, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x30, 0x08, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x4e, 0x08, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x6c, 0x08, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x8a, 0x08, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xa8, 0x08, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xc6, 0x08, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xe4, 0x08, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x02, 0x09, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x20, 0x09, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x3e, 0x09, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x5c, 0x09, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x7a, 0x09, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x98, 0x09, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xb6, 0x09, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xd4, 0x09, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xf2, 0x09, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x10, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x2e, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x4c, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x6a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x88, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xa6, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xc4, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xe2, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x00, 0x0b, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x1e, 0x0b, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x3c, 0x0b, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x5a, 0x0b, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x78, 0x0b, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x96, 0x0b, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xb4, 0x0b, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xd2, 0x0b, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xf0, 0x0b, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x0e, 0x0c, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x2c, 0x0c, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x4a, 0x0c, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x68, 0x0c, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x86, 0x0c, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xa4, 0x0c, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xc2, 0x0c, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xe0, 0x0c, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x1c, 0x0d, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x3a, 0x0d, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x58, 0x0d, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x76, 0x0d, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x94, 0x0d, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xb2, 0x0d, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0xd0, 0x0d, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0xee, 0x0d, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00,
+	0x0c, 0x0e, 0x00, 0x00, 0x0a, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x7f, 0x80, 0x7f, 0x80, 0x33, 0x00,
+	0x33, 0x00, 0x7f, 0x80, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x3e, 0x00, 0x7e, 0x00, 0x68, 0x00, 0x78, 0x00, 0x3e, 0x00,
+	0x0b, 0x00, 0x4b, 0x00, 0x7f, 0x00, 0x3e, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x70, 0x00, 0xd8, 0x00, 0x88, 0x00, 0xd0, 0x80, 0x77, 0x80, 0x1e, 0x00, 0x78, 0x00, 0x1b, 0x00,
+	0x11, 0x00, 0x1b, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00,
+	0x3f, 0x00, 0x31, 0x00, 0x30, 0x00, 0x18, 0x00, 0x3c, 0x00, 0x2e, 0xc0, 0x63, 0xc0, 0x73, 0x80,
+	0x3f, 0x80, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x6b, 0x00, 0x3e, 0x00, 0x3e, 0x00,
+	0x6b, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x7f, 0x80, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03, 0x00,
+	0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00,
+	0x30, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x33, 0x80,
+	0x61, 0x80, 0x61, 0x80, 0x6d, 0x80, 0x6d, 0x80, 0x61, 0x80, 0x33, 0x80, 0x3f, 0x00, 0x1e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3c, 0x00, 0x2c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x7f, 0x80, 0x7f, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x7f, 0x00, 0x41, 0x80, 0x01, 0x80, 0x01, 0x80,
+	0x03, 0x00, 0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0x7f, 0x80, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x7f, 0x00, 0x41, 0x80, 0x01, 0x80, 0x01, 0x80, 0x1f, 0x00,
+	0x1f, 0x00, 0x01, 0x80, 0x41, 0x80, 0x7f, 0x80, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x13, 0x00, 0x33, 0x00, 0x63, 0x00,
+	0x7f, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7f, 0x00, 0x7f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7e, 0x00, 0x7f, 0x00, 0x43, 0x80, 0x01, 0x80,
+	0x43, 0x80, 0x7f, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00,
+	0x3f, 0x00, 0x31, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x7f, 0x00, 0x73, 0x80, 0x61, 0x80, 0x73, 0x80,
+	0x3f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x7f, 0x80,
+	0x03, 0x80, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x18, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x61, 0x80,
+	0x61, 0x80, 0x61, 0x80, 0x3f, 0x00, 0x3f, 0x00, 0x61, 0x80, 0x61, 0x80, 0x7f, 0x80, 0x1e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x73, 0x80, 0x61, 0x80,
+	0x61, 0x80, 0x73, 0x80, 0x3f, 0x80, 0x01, 0x80, 0x23, 0x00, 0x3f, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x80, 0x1e, 0x00, 0x70, 0x00,
+	0x1e, 0x00, 0x07, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x7f, 0x80, 0x00, 0x00, 0x7f, 0x80,
+	0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x03, 0x80, 0x1e, 0x00, 0x78, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x7f, 0x00,
+	0x43, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00,
+	0x73, 0x80, 0xe1, 0x80, 0xcf, 0x80, 0xdf, 0x80, 0xdf, 0x80, 0xcf, 0x80, 0x60, 0x00, 0x71, 0x00,
+	0x3f, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00,
+	0x1e, 0x00, 0x33, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x33, 0x00, 0x73, 0x80, 0x61, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7f, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+	0x7f, 0x00, 0x7f, 0x00, 0x61, 0x80, 0x61, 0x80, 0x7f, 0x80, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x3f, 0x80, 0x30, 0x80, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
+	0x60, 0x00, 0x60, 0x00, 0x30, 0x80, 0x3f, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x7c, 0x00, 0x7f, 0x00, 0x63, 0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+	0x61, 0x80, 0x63, 0x00, 0x7f, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7f, 0x80, 0x7f, 0x80, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x60, 0x00,
+	0x60, 0x00, 0x7f, 0x80, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80,
+	0x7f, 0x80, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x60, 0x00, 0x60, 0x00,
+	0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x3f, 0x80,
+	0x30, 0x80, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x67, 0x80, 0x61, 0x80, 0x31, 0x80, 0x3f, 0x80,
+	0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+	0x61, 0x80, 0x61, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x0f, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+	0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x41, 0x80, 0x7f, 0x80, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x63, 0x80, 0x67, 0x00, 0x66, 0x00, 0x6c, 0x00, 0x7c, 0x00, 0x7c, 0x00,
+	0x7c, 0x00, 0x67, 0x00, 0x63, 0x00, 0x63, 0x80, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
+	0x60, 0x00, 0x60, 0x00, 0x7f, 0x80, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x73, 0x80, 0x73, 0x80, 0x73, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x6d, 0x80, 0x6d, 0x80, 0x61, 0x80,
+	0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x80,
+	0x71, 0x80, 0x71, 0x80, 0x79, 0x80, 0x69, 0x80, 0x6d, 0x80, 0x6d, 0x80, 0x67, 0x80, 0x63, 0x80,
+	0x63, 0x80, 0x63, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00,
+	0x33, 0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x33, 0x00, 0x3f, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7f, 0x80, 0x61, 0x80,
+	0x61, 0x80, 0x61, 0x80, 0x7f, 0x80, 0x7e, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x33, 0x00, 0x61, 0x80,
+	0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x33, 0x80, 0x3f, 0x00, 0x1e, 0x00, 0x03, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7f, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+	0x7f, 0x00, 0x7f, 0x00, 0x63, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x61, 0x00, 0x60, 0x00, 0x70, 0x00, 0x3e, 0x00,
+	0x1f, 0x00, 0x01, 0x80, 0x41, 0x80, 0x7f, 0x80, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x7f, 0x80, 0x7f, 0x80, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+	0x73, 0x80, 0x3f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x80,
+	0x73, 0x80, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x1e, 0x00, 0x1e, 0x00,
+	0x1e, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xcc, 0xc0, 0x6d, 0x80, 0x6d, 0x80, 0x6d, 0x80, 0x73, 0x80, 0x73, 0x80, 0x73, 0x80,
+	0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x80, 0x33, 0x00, 0x3f, 0x00,
+	0x1e, 0x00, 0x1e, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x33, 0x00, 0x73, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc0, 0x61, 0x80, 0x73, 0x80, 0x33, 0x00,
+	0x3f, 0x00, 0x1e, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x7f, 0x80, 0x03, 0x80, 0x07, 0x00, 0x06, 0x00,
+	0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0x7f, 0x80, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+	0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x60, 0x00, 0x20, 0x00, 0x30, 0x00, 0x10, 0x00, 0x18, 0x00, 0x08, 0x00, 0x0c, 0x00,
+	0x06, 0x00, 0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+	0x3e, 0x00, 0x77, 0x00, 0xe3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x3f, 0x80, 0x21, 0x80, 0x0f, 0x80, 0x71, 0x80, 0x63, 0x80, 0x7f, 0x80, 0x3d, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x7f, 0x00,
+	0x73, 0x80, 0x61, 0x80, 0x61, 0x80, 0x73, 0x80, 0x7f, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x3f, 0x80, 0x70, 0x80,
+	0x60, 0x00, 0x60, 0x00, 0x70, 0x80, 0x3f, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x1d, 0x80, 0x3f, 0x80, 0x73, 0x80, 0x61, 0x80,
+	0x61, 0x80, 0x73, 0x80, 0x3f, 0x80, 0x1d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x61, 0x80, 0x7f, 0x80, 0x60, 0x00,
+	0x70, 0x80, 0x3f, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+	0x1f, 0x00, 0x18, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+	0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1d, 0x80, 0x3f, 0x80, 0x73, 0x80, 0x61, 0x80, 0x73, 0x80, 0x3f, 0x80, 0x1d, 0x80,
+	0x21, 0x80, 0x3f, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
+	0x6f, 0x00, 0x7f, 0x80, 0x71, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3c, 0x00,
+	0x3c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x7f, 0x80, 0x7f, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x7c, 0x00, 0x78, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x67, 0x00, 0x6e, 0x00, 0x6c, 0x00,
+	0x78, 0x00, 0x6e, 0x00, 0x66, 0x00, 0x63, 0x00, 0x63, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+	0x18, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x7f, 0x80, 0x6d, 0x80, 0x6d, 0x80, 0x6d, 0x80,
+	0x6d, 0x80, 0x6d, 0x80, 0x6d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x7f, 0x80, 0x71, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+	0x61, 0x80, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x73, 0x80, 0x61, 0x80, 0x61, 0x80, 0x73, 0x80, 0x3f, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6e, 0x00, 0x7f, 0x00, 0x73, 0x80, 0x61, 0x80, 0x73, 0x80, 0x7f, 0x00, 0x6e, 0x00, 0x60, 0x00,
+	0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x80,
+	0x3f, 0x80, 0x73, 0x80, 0x61, 0x80, 0x73, 0x80, 0x3f, 0x80, 0x1d, 0x80, 0x01, 0x80, 0x01, 0x80,
+	0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x80, 0x3f, 0x80,
+	0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x7f, 0x80, 0x60, 0x80,
+	0x7e, 0x00, 0x03, 0x80, 0x41, 0x80, 0x7f, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x18, 0x00, 0x18, 0x00,
+	0x18, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+	0x63, 0x80, 0x7f, 0x80, 0x3d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x61, 0x80, 0x73, 0x80, 0x33, 0x00, 0x33, 0x00, 0x1e, 0x00, 0x1e, 0x00,
+	0x1e, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xcc, 0xc0, 0x4c, 0x80, 0x7f, 0x80, 0x73, 0x80, 0x33, 0x00,
+	0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x73, 0x80, 0x33, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x73, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x80,
+	0x33, 0x80, 0x33, 0x00, 0x3b, 0x00, 0x1e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x38, 0x00,
+	0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x7f, 0x80,
+	0x03, 0x00, 0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0x7f, 0x80, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x38, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x80, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ * fbfont.h - blit-ready font format produced by sw/fontconv
+ *
+ * Unlike the GLCD fonts (column-major, 8-row pages), glyphs here are stored
+ * row-major with every row starting on a byte boundary, pixels packed MSB
+ * first at 1, 2 or 4 bits per pixel. The glyph table holds the offset of
+ * each glyph from the start of the font, so no width summing is needed.
+ *
+ *   FBFONT_HDR                       16 bytes
+ *   FBFONT_GLYPH[char_count]          8 bytes each
+ *   (pad to 4 bytes)
+ *   glyph rows                       stride * height bytes per glyph
+ */
+#ifndef __FBFONT_H__
+#define __FBFONT_H__
+
+#include <stdint.h>
+
+/** declare a blit-ready font, aligned so the header can be read as a struct */
+#define FBFONTDECL(_n) static const uint8_t __attribute__((aligned(4))) _n[]
+
+#define FBFONT_MAGIC			 0x31465450 /* "PTF1" little-endian */
+#define FBFONT_FLAG_PROPORTIONAL 0x0001
+
+typedef struct {
+	uint32_t magic;
+	uint8_t	 bpp;		 /* 1, 2 or 4 bits per pixel */
+	uint8_t	 height;	 /* rows per glyph */
+	uint8_t	 max_width;	 /* widest glyph in pixels */
+	uint8_t	 first_char; /* code of the first glyph in the table */
+	uint16_t char_count;
+	uint16_t flags;
+	uint32_t size; /* total bytes, header included */
+} FBFONT_HDR;
+
+typedef struct {
+	uint32_t offset;  /* from the start of the font */
+	uint8_t	 width;	  /* pixels drawn */
+	uint8_t	 advance; /* pixels to the next glyph */
+	uint8_t	 stride;  /* bytes per glyph row */
+	uint8_t	 reserved;
+} FBFONT_GLYPH;
+
+#define fbfont_hdr(font)	((const FBFONT_HDR *)(font))
+#define fbfont_glyphs(font) ((const FBFONT_GLYPH *)((const uint8_t *)(font) + sizeof(FBFONT_HDR)))
+
+/* returns NULL when c is not in the font */
+static inline const FBFONT_GLYPH *fbfont_glyph(const uint8_t *font, int c)
+{
+	const FBFONT_HDR *hdr = fbfont_hdr(font);
+	if (c < hdr->first_char || c >= hdr->first_char + hdr->char_count)
+		return NULL;
+	return &fbfont_glyphs(font)[c - hdr->first_char];
+}
+
+#endif /* __FBFONT_H__ */
@@ -44,7 +44,13 @@ typedef struct {
 #define LCD_HEIGHT	   600
 #define LCD_FBADDR	   0xc0000000
 #define LCD_FBADDR2	   0xc012c000
+#define LCD_FBSIZE	   0x0012c000
+/* PSRAM beyond the two framebuffers, up to the end of the 8MB */
+#define LCD_SPAREADDR  (LCD_FBADDR2 + LCD_FBSIZE)
+#define LCD_SPAREEND   0xc0800000
 #define LCD_REGADDR	   0xc1000000
+#define LCD_TEXTADDR   0xc1008000
+#define LCD_SPRITEADDR 0xc1010000
 #define LCD_PIXELBYTES 2
 
 #define LCD_RED	  0xf800
@@ -59,6 +65,57 @@ typedef struct {
 	volatile uint32_t x0y0;
 	volatile uint32_t x1y1;
 	volatile uint32_t size;
+	volatile uint32_t caps;
+	volatile uint32_t srcaddr;
+	volatile uint32_t srcxy;
+	volatile uint32_t txtctrl;
+	volatile uint32_t txtcursor;
+	volatile uint32_t txtscroll;
+	volatile uint32_t txtpalette;
+	volatile uint32_t sprenable;
+	volatile uint32_t sprkey;
+	volatile uint32_t sprpos[4];
+	volatile uint32_t ovladdr;
+	volatile uint32_t ovlctrl;
+	volatile uint32_t ovlx0y0;
+	volatile uint32_t ovlx1y1;
+	volatile uint32_t fbmode;
+	volatile uint32_t palette;
+	volatile uint32_t fbsize;
+	volatile uint32_t arbctrl;
+	volatile uint32_t arbcpu;
+	volatile uint32_t arbvdma;
+	volatile uint32_t vdmastat;
+	volatile uint32_t frames;
+	volatile uint32_t plot;
+	volatile uint32_t clipx0y0;
+	volatile uint32_t clipx1y1;
+	volatile uint32_t stride;
+	volatile uint32_t trapxl;
+	volatile uint32_t trapdxl;
+	volatile uint32_t trapxr;
+	volatile uint32_t trapdxr;
+	volatile uint32_t trapr;
+	volatile uint32_t trapg;
+	volatile uint32_t trapb;
+	volatile uint32_t trapdrg;
+	volatile uint32_t trapdb;
+	volatile uint32_t gradc0;
+	volatile uint32_t gradc1;
+	volatile uint32_t gradt0;
+	volatile uint32_t gradtx;
+	volatile uint32_t gradty;
+	volatile uint32_t gradq;
+	volatile uint32_t gradctrl;
+	volatile uint32_t xfu0;
+	volatile uint32_t xfv0;
+	volatile uint32_t xfdudx;
+	volatile uint32_t xfdvdx;
+	volatile uint32_t xfdudy;
+	volatile uint32_t xfdvdy;
+	volatile uint32_t xfsrcmax;
+	volatile uint32_t spanaddr;
+	volatile uint32_t spanctrl;
 } LCD_REGS_T;
 
 #define lcd_regs ((LCD_REGS_T *)LCD_REGADDR)
@@ -70,11 +127,235 @@ typedef struct {
 #define GPU_X0Y0	 ((uint32_t *)LCD_REGADDR + 4)
 #define GPU_X1Y1	 ((uint32_t *)LCD_REGADDR + 5)
 #define GPU_SIZE	 ((uint32_t *)LCD_REGADDR + 6)
+#define GPU_CAPS	 ((uint32_t *)LCD_REGADDR + 7)
+#define GPU_SRCADDR	 ((uint32_t *)LCD_REGADDR + 8)
+#define GPU_SRCXY	 ((uint32_t *)LCD_REGADDR + 9)
+#define TXT_CTRL	 ((uint32_t *)LCD_REGADDR + 10)
+#define TXT_CURSOR	 ((uint32_t *)LCD_REGADDR + 11)
+#define TXT_SCROLL	 ((uint32_t *)LCD_REGADDR + 12)
+#define TXT_PALETTE	 ((uint32_t *)LCD_REGADDR + 13)
+#define SPR_ENABLE	 ((uint32_t *)LCD_REGADDR + 14)
+#define SPR_KEY		 ((uint32_t *)LCD_REGADDR + 15)
+#define SPR_POS(n)	 ((uint32_t *)LCD_REGADDR + 16 + (n))
+#define OVL_ADDR	 ((uint32_t *)LCD_REGADDR + 20)
+#define OVL_CTRL	 ((uint32_t *)LCD_REGADDR + 21)
+#define OVL_X0Y0	 ((uint32_t *)LCD_REGADDR + 22)
+#define OVL_X1Y1	 ((uint32_t *)LCD_REGADDR + 23)
+#define FB_MODE		 ((uint32_t *)LCD_REGADDR + 24)
+#define FB_PALETTE	 ((uint32_t *)LCD_REGADDR + 25)
+#define FB_SIZE		 ((uint32_t *)LCD_REGADDR + 26)
+#define ARB_CTRL	 ((uint32_t *)LCD_REGADDR + 27)
+#define ARB_CPU		 ((uint32_t *)LCD_REGADDR + 28)
+#define ARB_VDMA	 ((uint32_t *)LCD_REGADDR + 29)
+#define VDMA_STAT	 ((uint32_t *)LCD_REGADDR + 30)
+#define VDMA_FRAMES	 ((uint32_t *)LCD_REGADDR + 31)
+#define PLOT_PORT	 ((uint32_t *)LCD_REGADDR + 32)
+#define GPU_CLIPX0Y0 ((uint32_t *)LCD_REGADDR + 33)
+#define GPU_CLIPX1Y1 ((uint32_t *)LCD_REGADDR + 34)
+#define GPU_STRIDE	 ((uint32_t *)LCD_REGADDR + 35)
+#define GPU_TRAP(n)	 ((uint32_t *)LCD_REGADDR + 36 + (n))
+#define GPU_GRAD(n)	 ((uint32_t *)LCD_REGADDR + 45 + (n))
+#define GPU_XFORM(n) ((uint32_t *)LCD_REGADDR + 52 + (n))
+#define GPU_SPANADDR ((uint32_t *)LCD_REGADDR + 59)
+#define GPU_SPANCTRL ((uint32_t *)LCD_REGADDR + 60)
 
-#define CTRLSTAT_BUSY 0x0001
-#define GPU_SETBG	  1
-#define GPU_SETPT	  2
-#define GPU_FRECT	  3
+#define CTRLSTAT_BUSY	0x0001
+#define GPU_SETBG		1
+#define GPU_SETPT		2
+#define GPU_FRECT		3
+#define GPU_BLIT		4
+#define GPU_TRAP_FLAT	5
+#define GPU_TRAP_SHADED 6
+#define GPU_FRECT_BLEND 7
+#define GPU_BLIT_BLEND	8
+#define GPU_GRADIENT	9
+#define GPU_BLIT_XFORM	10
+#define GPU_SPANS		11
+
+/* read-only caps register bits, tells what the loaded bitstream supports */
+#define GPU_CAP_BLIT	0x0001
+#define GPU_CAP_TEXT	0x0002
+#define GPU_CAP_SPRITES 0x0004
+#define GPU_CAP_OVERLAY 0x0008
+#define GPU_CAP_INDEXED 0x0010
+#define GPU_CAP_SCALED	0x0020
+#define GPU_CAP_ARB		0x0040
+#define GPU_CAP_VSTAT	0x0080
+/* PSRAM burst length of the bitstream (16, 32, 64, 128), 0 before it was reported */
+#define GPU_CAP_BURST(c) (((c) >> 8) & 0xff)
+#define GPU_CAP_PLOT	0x00010000
+#define GPU_CAP_CLIP	0x00020000
+#define GPU_CAP_SURFACE 0x00040000
+#define GPU_CAP_TRAP	0x00080000
+#define GPU_CAP_BLEND	0x00100000
+#define GPU_CAP_GRAD	0x00200000
+#define GPU_CAP_XFORM	0x00400000
+#define GPU_CAP_SPANS	0x00800000
+
+/*
+ * Hardware text layer: one word per cell at LCD_TEXTADDR, row-major with
+ * TXT_STRIDE cells per row, {attr, char} in the low 16 bits. attr is
+ * bg << 4 | fg, both palette indices. The cells are write-only.
+ */
+#define TXT_STRIDE		   128
+#define TXT_ROWS		   40
+#define TXT_CELL_W		   10
+#define TXT_CELL_H		   15
+#define TXT_COLS		   (LCD_WIDTH / TXT_CELL_W)
+#define TXT_CELL(col, row) ((volatile uint32_t *)LCD_TEXTADDR + (row) * TXT_STRIDE + (col))
+
+#define TXTCTRL_ENABLE		0x0001
+#define TXTCTRL_CURSOR		0x0002
+#define TXTCTRL_BLINK		0x0004
+#define TXTCTRL_TRANSPARENT 0x0008 /* bg color 0 shows the framebuffer */
+
+/*
+ * Hardware sprites: SPR_COUNT of SPR_W x SPR_H RGB565, one word per pixel
+ * at LCD_SPRITEADDR (write-only), sprite 0 on top. Pixels equal to the key
+ * color are transparent. Positions are signed, enables and positions take
+ * effect at the next frame.
+ */
+#define SPR_COUNT		   4
+#define SPR_W			   32
+#define SPR_H			   32
+#define SPR_PIXEL(n, x, y) ((volatile uint32_t *)LCD_SPRITEADDR + (n) * SPR_W * SPR_H + (y) * SPR_W + (x))
+#define SPR_XY(x, y)	   (((x) & 0xfff) | (((y) & 0xfff) << 16))
+
+/*
+ * Overlay layer: a second surface (2048 bytes per line, 2048-byte aligned)
+ * composited over the base framebuffer inside the window x0y0..x1y1
+ * (inclusive, inside the screen). Overlay pixel (0,0) is shown at the
+ * window top left, only the window part of each line is fetched. All
+ * overlay registers take effect at the next frame.
+ */
+#define OVLCTRL_ENABLE		   0x0001
+#define OVLCTRL_KEY			   0x0002 /* key color pixels show the base */
+#define OVLCTRL_ALPHA(a)	   (((a) & 0xff) << 8) /* 255 opaque */
+#define OVLCTRL_KEYCOLOR(c565) (((c565) & 0xffff) << 16)
+#define OVL_XY(x, y)		   (((x) & 0x7ff) | (((y) & 0x3ff) << 16))
+
+/*
+ * Pixel depth of the scanout (latched in the vertical blank) and of the GPU
+ * ops, both at 2048 bytes per line. At 8/4bpp argb[7:0] is the palette
+ * index for fills and the lowest pixel of a byte is in its low bits. GPU
+ * ops write whole bytes, so at 4bpp x is rounded to even pixel pairs.
+ * With scale 1 or 2 every pixel and line is shown 2x or 4x (512x300,
+ * 256x150); FB_SIZE reads back {height, width} at the selected scale and
+ * SETBG clears only that area. Overlay, text and sprites stay 1x.
+ */
+#define FBMODE_BPP16			  0
+#define FBMODE_BPP8				  1
+#define FBMODE_BPP4				  2
+#define FBMODE_SCAN(d)			  ((d) & 3)
+#define FBMODE_DRAW(d)			  (((d) & 3) << 8)
+#define FBMODE_DRAW_MASK		  0x0300
+#define FBMODE_SCALE(s)			  (((s) & 3) << 4)
+#define FBMODE_SCALE_MASK		  0x0030
+#define FB_PALETTE_ENTRY(i, c565) ((((i) & 0xff) << 16) | ((c565) & 0xffff))
+
+/*
+ * PSRAM arbiter: a video block goes before CPU and GPU only when it lags
+ * the beam by more than the slack, CPU and GPU take turns, and a CPU
+ * access that has waited the max wait (mclk cycles, 0 unbounded) goes
+ * first. The counters saturate, a write to ARB_CPU or ARB_VDMA clears them.
+ */
+#define ARBCTRL_MAXWAIT(c)		((c) & 0xffff)
+#define ARBCTRL_MAXWAIT_MASK	0x0000ffff
+#define ARBCTRL_SLACK(px)		(((px) & 0x7ff) << 16)
+#define ARBCTRL_SLACK_MASK		0x07ff0000
+#define ARBCPU_WAITMAX(v)		((v) & 0xffff) /* longest CPU wait seen */
+#define ARBCPU_FORCED(v)		((v) >> 16)	   /* CPU grants forced by max wait */
+
+/*
+ * Scanout health of the last frame: lines not complete when their row
+ * started, and video blocks the beam reached before they were written
+ * (each is a visible glitch). VDMA_FRAMES counts frames since reset.
+ */
+#define VSTAT_LATE(v)	  ((v) & 0xffff)
+#define VSTAT_UNDERRUN(v) ((v) >> 16)
+
+/*
+ * Plot port: one store draws a point on the work surface. Points are
+ * queued (a store stalls while the queue is full) and consecutive points
+ * in the same 32-byte block of a line go out as one masked write. The
+ * color is RGB444 at 16bpp, the palette index at 8/4bpp (4bpp sets the
+ * pixel pair). Reading gives the blocks written since reset; CTRLSTAT_BUSY
+ * stays set until the queue has drained.
+ */
+#define PLOT_XYC(x, y, c12) (((x) & 0x3ff) | (((y) & 0x3ff) << 10) | ((uint32_t)(c12) << 20))
+
+/*
+ * Scissor: GPU ops and plot port points are clipped to the inclusive rect
+ * GPU_CLIPX0Y0..GPU_CLIPX1Y1 (signed, reset to the screen), to x, y >= 0
+ * and to the 2048 byte line; SETBG also to the surface. x0y0/x1y1 of the
+ * ops are signed too, a blit moves its source with the clipped corner.
+ */
+#define CLIP_XY(x, y) (((x) & 0xffff) | (((y) & 0xffff) << 16))
+
+/*
+ * Render target of the GPU ops and the plot port: GPU_SIZE is the target
+ * {height, width} in pixels, GPU_STRIDE the line strides in bytes of the
+ * blit source and of the target. 0 selects the screen (2048 byte lines,
+ * SETBG clears fb_width x fb_height). Work address, source address and
+ * strides must be multiples of the PSRAM burst in bytes (2x the burst
+ * length); the ops clip to the target.
+ */
+#define TARGET_SIZE(w, h)		(((w) & 0xffff) | (((h) & 0xffff) << 16))
+#define TARGET_STRIDE(src, dst) (((dst) & 0xffff) | (((src) & 0xffff) << 16))
+
+/*
+ * Trapezoid op: lines y0..y1 of x0y0/x1y1 (clipped like a filled rect,
+ * x0..x1 bounds the spans) between a left and a right edge. trapxl/trapxr
+ * are the edges at line y0 and trapdxl/trapdxr their steps per line, all
+ * signed 16.16; pixel x is drawn when xl <= x < xr. GPU_TRAP_SHADED
+ * interpolates RGB at 16bpp (flat with argb at 8/4bpp): trapr/g/b hold the
+ * channel at the left edge of line y0 and its step per pixel, trapdrg/trapdb
+ * the steps per line along the left edge, all signed 8.8 (0xff00 is full).
+ */
+#define TRAP_CHANNEL(c, dx) (((c) & 0xffff) | ((uint32_t)(dx) << 16))
+#define TRAP_DY(dr, dg)		(((dr) & 0xffff) | ((uint32_t)(dg) << 16))
+
+/*
+ * Blended ops: FRECT_BLEND mixes the color, BLIT_BLEND the source over the
+ * destination with the alpha byte of argb (255 opaque, 0 leaves it), in
+ * RGB565 with one read-modify-write per 32-byte block. At 8/4bpp or with
+ * alpha 255 they are plain FRECT and BLIT.
+ */
+#define ARGB_ALPHA(argb, a) (((argb) & 0x00ffffff) | ((uint32_t)(a) << 24))
+
+/*
+ * Gradient op: fills x0y0/x1y1 with gradc0 + (gradc1 - gradc0) * t per
+ * RGB888 channel at 16bpp (flat with argb at 8/4bpp), at the cost of a
+ * blended fill without its reads. t(x, y) = gradt0 + gradtx * x + gradty
+ * * y + gradq * (x * x + y * y) in target coordinates, gradt0 signed 20.12,
+ * gradtx/gradty 8.24, gradq 4.28, clamped to 0..1. GRAD_RADIAL takes the
+ * square root of t first (t being the squared distance to a center over
+ * the squared radius), GRAD_DITHER rounds to RGB565 with a 4x4 ordered
+ * dither.
+ */
+#define GRAD_RADIAL 0x0001
+#define GRAD_DITHER 0x0002
+
+/*
+ * Transform blit: fills x0y0/x1y1 at 16bpp with the nearest source pixel
+ * (srcaddr, source stride) at u = xfu0 + xfdudx * x + xfdudy * y and v =
+ * xfv0 + xfdvdx * x + xfdvdy * y, all signed 16.16 of target x, y, clamped
+ * to 0..xfsrcmax {vmax, umax}. Source surfaces are up to 2048 x 2048.
+ */
+#define XFORM_SRCMAX(umax, vmax) (((umax) & 0xffff) | (((vmax) & 0xffff) << 16))
+
+/*
+ * Span list op: fills the spanctrl count spans of a list at spanaddr in
+ * PSRAM (SPAN_ALIGN aligned), 8 bytes each {x0, x1, y, color} as int16_t
+ * with x0..x1 inclusive, clipped to the scissor and target (x0y0/x1y1 are
+ * not used). With SPAN_COLORS every span has its color (RGB565, the
+ * palette index at 8/4bpp), else all take argb. The list is read a block
+ * of 4 spans at a time.
+ */
+#define SPAN_ALIGN			 32
+#define SPAN_COUNT_MAX		 0xffff
+#define SPAN_COLORS			 0x80000000
+#define SPAN_CTRL(n, colors) (((n) & 0xffff) | ((colors) ? SPAN_COLORS : 0))
 
 typedef struct {
 	volatile uint32_t msec;
@@ -84,4 +365,46 @@ typedef struct {
 #define MY_DEVS_REGADDR 0xc2000000
 #define my_devices		((MY_DEVS_T *)MY_DEVS_REGADDR)
 
+/*
+ * DMA engine: runs a chain of descriptors from desc, each moving lines x
+ * bytes from src to dst a word at a time, then stepping both by their
+ * stride, until next is 0. Every field must be 4-aligned and dst not in
+ * flash, else the chain stops with DMA_STAT_ERROR. PSRAM is read and
+ * written as whole bursts, the rest over the bus. Lines 0 counts as 1.
+ * Copies run forward only.
+ */
+typedef struct {
+	uint32_t src;
+	uint32_t dst;
+	uint32_t size;	 /* DMA_SIZE */
+	uint32_t stride; /* DMA_STRIDE */
+	uint32_t next;
+} DMA_DESC;
+
+typedef struct {
+	volatile uint32_t ctrl; /* DMA_CTRL_* to write, DMA_STAT_* to read */
+	volatile uint32_t desc;
+	volatile uint32_t cur;
+	volatile uint32_t moved;
+	volatile uint32_t id;
+} DMA_REGS_T;
+
+#define DMA_REGADDR 0xc3000000
+#define dma_regs	((DMA_REGS_T *)DMA_REGADDR)
+#define DMA_ID		0x444d4131 /* "DMA1" */
+
+#define DMA_CTRL_START 0x00000001
+#define DMA_CTRL_IRQEN 0x00000002
+#define DMA_CTRL_ABORT 0x00000004
+
+#define DMA_STAT_BUSY  0x00000001
+#define DMA_STAT_IRQEN 0x00000002
+#define DMA_STAT_DONE  0x00000004
+#define DMA_STAT_ERROR 0x00000008
+
+#define DMA_IRQ					3
+#define DMA_LINE_MAX			0xfffc
+#define DMA_SIZE(bytes, lines)	(((bytes) & 0xffff) | (((lines) & 0xffff) << 16))
+#define DMA_STRIDE(src, dst)	(((dst) & 0xffff) | (((src) & 0xffff) << 16))
+
 #endif /* __HWDEFS_H__ */
\ No newline at end of file
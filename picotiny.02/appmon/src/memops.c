@@ -0,0 +1,177 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "hwdefs.h"
+#include "dma.h"
+#include "memops.h"
+
+/*
+ * memcpy and memset in place of newlib-nano's byte loops. The head goes
+ * a byte at a time up to a word boundary of dst, the bulk as words in
+ * whole MEM_LINE lines of 8 stores in address order, the tail as bytes.
+ * A source at another word offset is read as words and shifted together.
+ * Large moves into or out of PSRAM go to the DMA engine when there is one,
+ * which reads and writes every block as one burst.
+ */
+
+/* else the compiler turns the loops below back into calls of themselves */
+#define NO_LIBCALLS __attribute__((optimize("no-tree-loop-distribute-patterns")))
+
+/* -1 until the DMA engine was probed */
+static int8_t dma_state = -1;
+
+static inline bool in_psram(const void *p)
+{
+	return (uintptr_t)p >= LCD_FBADDR && (uintptr_t)p < LCD_SPAREEND;
+}
+
+static bool dma_ready(void)
+{
+	if (dma_state < 0)
+		dma_state = dma_available();
+	return dma_state && !(dma_status() & DMA_STAT_BUSY);
+}
+
+/* off leaves large PSRAM moves to the CPU, for comparisons */
+void mem_use_dma(bool on)
+{
+	dma_state = on ? -1 : 0;
+}
+
+bool mem_uses_dma(void)
+{
+	return dma_ready();
+}
+
+/* newlib-nano's loops, for comparisons */
+NO_LIBCALLS void mem_copy_bytes(void *dst, const void *src, size_t n)
+{
+	uint8_t		  *d = dst;
+	const uint8_t *s = src;
+
+	while (n--)
+		*d++ = *s++;
+}
+
+NO_LIBCALLS void mem_set_bytes(void *dst, int c, size_t n)
+{
+	uint8_t *d = dst;
+
+	while (n--)
+		*d++ = c;
+}
+
+/* n bytes of whole words, d and s word aligned */
+static NO_LIBCALLS void copy_words(uint32_t *d, const uint32_t *s, size_t n)
+{
+	for (; n >= 4 && ((uintptr_t)d & (MEM_LINE - 1)); n -= 4)
+		*d++ = *s++;
+	for (; n >= MEM_LINE; n -= MEM_LINE, d += 8, s += 8) {
+		uint32_t w0 = s[0], w1 = s[1], w2 = s[2], w3 = s[3];
+		uint32_t w4 = s[4], w5 = s[5], w6 = s[6], w7 = s[7];
+		d[0] = w0, d[1] = w1, d[2] = w2, d[3] = w3;
+		d[4] = w4, d[5] = w5, d[6] = w6, d[7] = w7;
+	}
+	for (; n >= 4; n -= 4)
+		*d++ = *s++;
+}
+
+/*
+ * n bytes of whole words, d word aligned, s not: every word is the top of
+ * one source word and the bottom of the next. Reads stay within the words
+ * holding source bytes.
+ */
+static NO_LIBCALLS void copy_shifted(uint32_t *d, const uint8_t *s, size_t n)
+{
+	const uint32_t *sw = (const uint32_t *)((uintptr_t)s & ~3);
+	int				lo = ((uintptr_t)s & 3) * 8, hi = 32 - lo;
+	uint32_t		w = *sw++;
+
+	for (; n >= 4 && ((uintptr_t)d & (MEM_LINE - 1)); n -= 4) {
+		uint32_t next = *sw++;
+		*d++ = (w >> lo) | (next << hi);
+		w = next;
+	}
+	for (; n >= MEM_LINE; n -= MEM_LINE, d += 8, sw += 8) {
+		uint32_t w0 = sw[0], w1 = sw[1], w2 = sw[2], w3 = sw[3];
+		uint32_t w4 = sw[4], w5 = sw[5], w6 = sw[6], w7 = sw[7];
+		d[0] = (w >> lo) | (w0 << hi), d[1] = (w0 >> lo) | (w1 << hi);
+		d[2] = (w1 >> lo) | (w2 << hi), d[3] = (w2 >> lo) | (w3 << hi);
+		d[4] = (w3 >> lo) | (w4 << hi), d[5] = (w4 >> lo) | (w5 << hi);
+		d[6] = (w5 >> lo) | (w6 << hi), d[7] = (w6 >> lo) | (w7 << hi);
+		w = w7;
+	}
+	for (; n >= 4; n -= 4) {
+		uint32_t next = *sw++;
+		*d++ = (w >> lo) | (next << hi);
+		w = next;
+	}
+}
+
+static NO_LIBCALLS void set_words(uint32_t *d, uint32_t w, size_t n)
+{
+	for (; n >= 4 && ((uintptr_t)d & (MEM_LINE - 1)); n -= 4)
+		*d++ = w;
+	for (; n >= MEM_LINE; n -= MEM_LINE, d += 8) {
+		d[0] = w, d[1] = w, d[2] = w, d[3] = w;
+		d[4] = w, d[5] = w, d[6] = w, d[7] = w;
+	}
+	for (; n >= 4; n -= 4)
+		*d++ = w;
+}
+
+NO_LIBCALLS void *memcpy(void *dst, const void *src, size_t n)
+{
+	uint8_t		  *d = dst;
+	const uint8_t *s = src;
+	size_t		   words;
+	bool		   done = false;
+
+	if (n < 8) {
+		mem_copy_bytes(d, s, n);
+		return dst;
+	}
+	for (; (uintptr_t)d & 3; n--)
+		*d++ = *s++;
+	words = n & ~3;
+	if (!((uintptr_t)s & 3) && words >= MEM_DMA_MIN && (in_psram(d) || in_psram(s)) &&
+		dma_ready())
+		done = dma_copy((uint32_t)d, (uint32_t)s, words) >= 0;
+	if (!done && ((uintptr_t)s & 3))
+		copy_shifted((uint32_t *)d, s, words);
+	else if (!done)
+		copy_words((uint32_t *)d, (const uint32_t *)s, words);
+	mem_copy_bytes(d + words, s + words, n - words);
+	return dst;
+}
+
+NO_LIBCALLS void *memset(void *dst, int c, size_t n)
+{
+	uint8_t *d = dst;
+	uint32_t w = c & 0xff;
+	size_t	 lines;
+
+	if (n < 8) {
+		mem_set_bytes(d, c, n);
+		return dst;
+	}
+	w |= w << 8;
+	w |= w << 16;
+	for (; (uintptr_t)d & 3; n--)
+		*d++ = c;
+	if (n >= MEM_DMA_MIN && in_psram(d) && dma_ready()) {
+		/* the DMA engine fills whole lines from a line boundary */
+		for (; (uintptr_t)d & (MEM_LINE - 1); n -= 4, d += 4)
+			*(uint32_t *)d = w;
+		lines = n & ~(MEM_LINE - 1);
+		if (dma_fill((uint32_t)d, w, lines) >= 0) {
+			d += lines;
+			n -= lines;
+		}
+	}
+	set_words((uint32_t *)d, w, n & ~3);
+	mem_set_bytes(d + (n & ~3), c, n & 3);
+	return dst;
+}
@@ -0,0 +1,16 @@
+#ifndef __MEMOPS_H__
+#define __MEMOPS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define MEM_LINE	32	/* a PSRAM block */
+#define MEM_DMA_MIN 256 /* bytes from where PSRAM moves go to the DMA engine */
+
+void mem_use_dma(bool on);
+bool mem_uses_dma(void);
+void mem_copy_bytes(void *dst, const void *src, size_t n);
+void mem_set_bytes(void *dst, int c, size_t n);
+
+#endif /* __MEMOPS_H__ */
@@ -10,6 +10,7 @@
 
 #include "hwdefs.h"
 #include "picotiny_hw.h"
+#include "fb_console.h"
 
 /* Foobar with C-compilers, see:
  * https://stackoverflow.com/questions/16831605/strange-compiler-warning-c-warning-struct-declared-inside-parameter-list
@@ -70,8 +71,10 @@ __attribute__((weak)) int _write(int file, char *ptr, int len)
 	int DataIdx;
 
 	for (DataIdx = 0; DataIdx < len; DataIdx++) {
-		__io_putchar(*ptr++);
+		__io_putchar(ptr[DataIdx]);
 	}
+	/* mirror to the LCD, one flush per write */
+	fbcon_write(ptr, len);
 	return len;
 }
 
@@ -35,6 +35,17 @@ inline float mapf(float x, float in_min, float in_max, float out_min, float out_
 #define stringify_expanded(x)	 stringify_literal(x)
 #define stringify_with_quotes(x) stringify_expanded(stringify_expanded(x))
 
+/* code copied to SRAM with .data and run from there, off the flash XIP */
+#define RAMFUNC __attribute__((section(".ramfunc"), noinline))
+
+/* CPU clocks since reset, wrapping */
+static inline uint32_t cpu_cycles(void)
+{
+	uint32_t cycles;
+	__asm__ volatile("rdcycle %0" : "=r"(cycles));
+	return cycles;
+}
+
 #define systime_msec()					(my_devices->msec)
 #define msec_expired(PREV_MSEC, PERIOD) (((systime_msec() - (PREV_MSEC)) & UINT_MAX) > (PERIOD))
 
@@ -27,6 +27,13 @@ module PSRAM_FRAMEBUFFER_LCD (
     input [3:0] mem_s_wstrb,
     output [31:0] mem_s_rdata,
     output mem_s_ready,
+    input dma_req,
+    input dma_we,
+    input [22:0] dma_addr,
+    input [255:0] dma_wdata,
+    input [31:0] dma_wbytes,
+    output dma_ack,
+    output [255:0] dma_rdata,
 
     output [1:0] O_psram_ck,
     output [1:0] O_psram_ck_n,
@@ -61,20 +68,52 @@ module PSRAM_FRAMEBUFFER_LCD (
     localparam VDMA_LINEADDR_STRIDE = 23'd2048;
 `endif
 
+`ifndef PSRAM_BURST
+`define PSRAM_BURST 16  // BURST_MODE of gowin_ip/psram_memory_interface_hs: 16, 32, 64, 128
+`endif
+    /* One PSRAM command moves PSRAM_BEATS 64-bit words, i.e. PSRAM_BLKS of
+     * the 32-byte blocks VDMA and GPU work in. A write command takes 10
+     * cycles plus one per beat (IPUG 943 Table 4-2, Tcmd 14 at burst 16).
+     * Bursts wrap, so multi-block commands start at a multiple of their
+     * own size. */
+    localparam PSRAM_BEATS = `PSRAM_BURST / 4;
+    localparam PSRAM_BLKS = PSRAM_BEATS / 4;
+    localparam PSRAM_TCMD = 10 + PSRAM_BEATS;
+
+    localparam H_MAX = LCD_WIDTH + H_FrontPorch + H_PulseWidth + H_BackPorch;
+
     reg [10:0] CounterX;
     reg [9:0] CounterY;
     wire [10:0] PixelCount = CounterX;
-    wire [10:0] dma_raddr = CounterX;
 
     reg vga_HS, vga_VS, inDisplayArea;
     reg [4:0] Data_R;
     reg [5:0] Data_G;
     reg [4:0] Data_B;
     wire [15:0] dout_o;
+    wire [15:0] base_pix_o;
+    wire [15:0] ovl_pix_o;
+    wire [15:0] txt_pix_o;
+    wire [15:0] spr_pix_o;
 
-    wire CounterXmaxed = (CounterX == (LCD_WIDTH + H_FrontPorch + H_PulseWidth + H_BackPorch));
+    wire CounterXmaxed = (CounterX == H_MAX);
     wire CounterYmaxed = (CounterY == (LCD_HEIGHT + V_FrontPorch + V_PulseWidth + V_BackPorch));
 
+    /* The base linebuffer is read two pixels ahead: one register for the
+     * palette lookup, one for the overlay mix. At 8/4bpp one linebuffer
+     * word holds 2/4 pixels, the lowest pixel in the low bits. In the
+     * pixel-doubled modes every source pixel is read 2 or 4 times. */
+    reg [1:0] scan_bpp_l;
+    reg [1:0] scan_scale_l;
+    wire [10:0] scan_x = CounterXmaxed ? 11'd1 :
+                         (CounterX == H_MAX - 1'b1) ? 11'd0 : CounterX + 2'd2;
+    wire [10:0] src_x = scan_x >> scan_scale_l;
+    wire [10:0] dma_raddr = src_x >> scan_bpp_l;
+    /* the linebuffers are ping-pong: source line n is in half n[0], the
+     * other half is filled meanwhile */
+    wire [9:0] scan_line = (CounterX >= H_MAX - 1'b1) ? CounterY : CounterY - 1'b1;
+    wire [9:0] scan_srcline = scan_line >> scan_scale_l;
+
     always @(posedge pclk)
         if (CounterXmaxed) CounterX <= 0;
         else CounterX <= CounterX + 1'b1;
@@ -96,9 +135,9 @@ module PSRAM_FRAMEBUFFER_LCD (
     always @(posedge pclk) begin
         inDisplayArea <= (CounterX > 0 && CounterX <= LCD_WIDTH) &&
                          (CounterY > 0 && CounterY <= LCD_HEIGHT);
-        Data_R <= dout_o[15:11];
-        Data_G <= dout_o[10:5];
-        Data_B <= dout_o[4:0];
+        Data_R <= spr_pix_o[15:11];
+        Data_G <= spr_pix_o[10:5];
+        Data_B <= spr_pix_o[4:0];
     end
 
     assign LCD_HSYNC = ~vga_HS;
@@ -108,18 +147,76 @@ module PSRAM_FRAMEBUFFER_LCD (
     assign LCD_G     = Data_G;
     assign LCD_B     = Data_B;
 
-    /*  to also start at line before zero because inDisplay starts at 1 */
-    wire vdma_start = vga_HS && ((CounterY < LCD_HEIGHT) || CounterYmaxed);
+    /* Line k is fetched during row k and shown during row k+1 (inDisplay
+     * starts at 1), so each line gets a whole row to arrive. The row after
+     * the last line only checks that it arrived, the row before zero
+     * restarts the frame. */
+    wire vdma_start = (CounterX < 11'd16) && ((CounterY <= LCD_HEIGHT) || CounterYmaxed);
 
     wire [31:0] gpu_ctrl;
     wire [22:0] disp_addr;
     wire [22:0] work_addr;
     wire [15:0] rgb565;
+    wire [7:0] color_idx;
+    wire [7:0] color_alpha;
+    wire [31:0] fb_mode;
+    wire [1:0] draw_bpp = fb_mode[9:8];
+    wire [1:0] fb_scale = fb_mode[5:4];
+    wire pal_we;
+    wire [7:0] pal_waddr;
+    wire [15:0] pal_wdata;
     wire [31:0] x0y0_point;
     wire [31:0] x1y1_point;
+    wire [22:0] src_addr;
+    wire [31:0] srcxy_point;
+    wire [31:0] txt_ctrl;
+    wire [31:0] txt_cursor;
+    wire [31:0] txt_scroll;
+    wire [255:0] txt_palette;
+    wire txt_we;
+    wire [12:0] txt_waddr;
+    wire [15:0] txt_wdata;
+    wire [31:0] spr_enable;
+    wire [31:0] spr_key;
+    wire [127:0] spr_pos;
+    wire spr_we;
+    wire [11:0] spr_waddr;
+    wire [15:0] spr_wdata;
+    wire [22:0] ovl_addr;
+    wire [31:0] ovl_ctrl;
+    wire [31:0] ovl_x0y0;
+    wire [31:0] ovl_x1y1;
+    wire ovl_on_l;
+    wire [22:0] ovl_addr_l;
+    wire [10:0] ovl_x0_l, ovl_x1_l;
+    wire [9:0] ovl_y0_l, ovl_y1_l;
+    reg ovl_wstrb;
     wire is_busy;
+    wire [31:0] arb_ctrl;
+    wire arb_clr;
+    reg [15:0] arb_cpu_waitmax;
+    reg [15:0] arb_cpu_forced;
+    reg [31:0] arb_vdma_urgent;
+    reg [31:0] vdma_stat;
+    reg [31:0] vdma_frames;
+    wire plot_we;
+    wire [31:0] plot_wdata;
+    wire plot_full;
+    reg [31:0] plot_bursts;
+    wire [31:0] clip_x0y0;
+    wire [31:0] clip_x1y1;
+    wire [31:0] target_size;
+    wire [31:0] gpu_stride;
+    wire [287:0] trap_params;
+    wire [223:0] grad_params;
+    wire [223:0] xf_params;
+    wire [63:0] span_params;
 
-    FB_Registers fb_regs (
+    FB_Registers #(
+        .LCD_WIDTH(LCD_WIDTH),
+        .LCD_HEIGHT(LCD_HEIGHT),
+        .PSRAM_BURST(`PSRAM_BURST)
+    ) fb_regs (
         .cpu_clk(clk),
         .resetn(resetn),
         .mem_valid(reg_valid),
@@ -133,11 +230,95 @@ module PSRAM_FRAMEBUFFER_LCD (
         .disp_addr(disp_addr),
         .work_addr(work_addr),
         .rgb565(rgb565),
+        .color_idx(color_idx),
+        .color_alpha(color_alpha),
         .x0y0_point(x0y0_point),
         .x1y1_point(x1y1_point),
+        .src_addr(src_addr),
+        .srcxy_point(srcxy_point),
+        .txt_ctrl(txt_ctrl),
+        .txt_cursor(txt_cursor),
+        .txt_scroll(txt_scroll),
+        .txt_palette(txt_palette),
+        .txt_we(txt_we),
+        .txt_waddr(txt_waddr),
+        .txt_wdata(txt_wdata),
+        .spr_enable(spr_enable),
+        .spr_key(spr_key),
+        .spr_pos(spr_pos),
+        .spr_we(spr_we),
+        .spr_waddr(spr_waddr),
+        .spr_wdata(spr_wdata),
+        .ovl_addr(ovl_addr),
+        .ovl_ctrl(ovl_ctrl),
+        .ovl_x0y0(ovl_x0y0),
+        .ovl_x1y1(ovl_x1y1),
+        .fb_mode(fb_mode),
+        .pal_we(pal_we),
+        .pal_waddr(pal_waddr),
+        .pal_wdata(pal_wdata),
+        .arb_ctrl(arb_ctrl),
+        .arb_clr(arb_clr),
+        .arb_cpu_i({arb_cpu_forced, arb_cpu_waitmax}),
+        .arb_vdma_i(arb_vdma_urgent),
+        .vdma_stat_i(vdma_stat),
+        .vdma_frames_i(vdma_frames),
+        .plot_we(plot_we),
+        .plot_wdata(plot_wdata),
+        .plot_full_i(plot_full),
+        .plot_bursts_i(plot_bursts),
+        .clip_x0y0(clip_x0y0),
+        .clip_x1y1(clip_x1y1),
+        .target_size(target_size),
+        .gpu_stride(gpu_stride),
+        .trap_params(trap_params),
+        .grad_params(grad_params),
+        .xf_params(xf_params),
+        .span_params(span_params),
         .busy_i(gpu_is_busy)
     );
 
+    FB_TextLayer #(
+        .H_MAX(H_MAX)
+    ) txt_layer (
+        .pclk(pclk),
+        .counter_x(CounterX),
+        .counter_y(CounterY),
+
+        .cell_clk(clk),
+        .cell_we(txt_we),
+        .cell_waddr(txt_waddr),
+        .cell_wdata(txt_wdata),
+
+        .txt_ctrl(txt_ctrl),
+        .txt_cursor(txt_cursor),
+        .txt_scroll(txt_scroll),
+        .txt_palette(txt_palette),
+
+        .pix_i(ovl_pix_o),
+        .pix_o(txt_pix_o)
+    );
+
+    FB_Sprites #(
+        .H_MAX(H_MAX)
+    ) sprites (
+        .pclk(pclk),
+        .counter_x(CounterX),
+        .counter_y(CounterY),
+
+        .spr_clk(clk),
+        .spr_we(spr_we),
+        .spr_waddr(spr_waddr),
+        .spr_wdata(spr_wdata),
+
+        .spr_enable(spr_enable),
+        .spr_key(spr_key),
+        .spr_pos(spr_pos),
+
+        .pix_i(txt_pix_o),
+        .pix_o(spr_pix_o)
+    );
+
     reg cmd_en_i;
     reg cmd_i;
     reg [20:0] addr_i;
@@ -168,12 +349,12 @@ module PSRAM_FRAMEBUFFER_LCD (
         .data_mask      (data_mask_i)       //input [7:0] data_mask
     );
 
-    reg [3:0] state;
-    reg [5:0] cycle;  // 14 cycles between write and read
+    reg [4:0] state;
+    reg [5:0] cycle;  // PSRAM_TCMD cycles between write and read
     reg [31:0] read_back;
     reg [7:0] read_count;
     reg completed;
-    localparam READ_COUNT_TOP = 2'b11;
+    localparam READ_COUNT_TOP = PSRAM_BEATS - 1;
 
     assign mem_s_ready = completed;
     assign mem_s_rdata = read_back;
@@ -197,94 +378,561 @@ module PSRAM_FRAMEBUFFER_LCD (
     assign w_remap[7] = 3'd5;
 
     reg [2:0] vdma_start_sr;
-    reg [7:0] vdma_waddr;
+    reg vdma_newline;
+    reg [8:0] vdma_waddr;
     reg [63:0] vdma_wdata;
     reg vdma_wstrb;
     reg vdma_waitinc;
+    reg vdma_line;
+    reg vdma_bank;
     reg [7:0] vdma_blkcnt;
-    reg [9:0] vdma_lineidx;
+    reg [22:0] vdma_frameaddr;
     reg [22:0] vdma_lineaddr;
+    /* beam position for pacing; a stale sample only shifts a fetch by a
+     * few pixels of the row it has */
+    reg [10:0] vdma_beam_x;
+
+    /* overlay layer: only the blocks inside its window are fetched, into
+     * its own linebuffer, interleaved with the base line in beam order */
+    reg ovl_line;
+    reg ovl_bank;
+    reg [6:0] ovl_blkcnt;
+    reg [22:0] ovl_lineaddr;
+    wire [6:0] ovl_nblk = ((ovl_x1_l - ovl_x0_l) >> 4) + 1'b1;
+    wire ovl_pend = ovl_line && (ovl_blkcnt < ovl_nblk);
+    /* blocks per line shrink with the scanout depth and scale, and in the
+     * pixel-doubled modes only every 2nd or 4th line is fetched, the others
+     * repeat the linebuffer */
+    wire [2:0] scan_shift = scan_bpp_l + scan_scale_l;
+    wire [7:0] vdma_nblk = (VDMA_MAXBLKCNT + (8'd1 << scan_shift) - 1'b1) >> scan_shift;
+    wire [1:0] scan_repmask = (3'd1 << scan_scale_l) - 1'b1;
+    wire vdma_pend = vdma_line && (vdma_blkcnt < vdma_nblk);
+    wire [11:0] ovl_next_x = ovl_x0_l + {ovl_blkcnt, 4'b0};
+    /* linebuffer word of each beat, a command fills PSRAM_BLKS blocks */
+    wire [7:0] vdma_run_waddr = {vdma_blkcnt[5:0], 2'b0} + read_count;
+    wire [7:0] ovl_run_waddr = {ovl_blkcnt[5:0], 2'b0} + read_count;
+    wire [11:0] vdma_next_x = {vdma_blkcnt[6:0], 4'b0} << scan_shift;
+    /* A block is only fetched once the beam has reached its x on the row
+     * before it is shown, so the line is spread over the whole row and
+     * the CPU and GPU get the slots in between: while scanning out, the
+     * VDMA takes at most one block ahead of any other access.
+     * A line still incomplete when its row starts is late: the next line
+     * waits, the rest is fetched at once racing the beam, and every block
+     * the beam reaches before it is written counts as an underrun. */
+    reg [15:0] vdma_late_cnt;
+    reg [15:0] vdma_under_cnt;
+    wire vdma_due = vdma_pend && (vdma_newline || (vdma_next_x <= vdma_beam_x));
+    wire ovl_due = ovl_pend && (vdma_newline || (ovl_next_x <= vdma_beam_x));
+
+    /* Arbiter: due video blocks only go first once they lag the beam by
+     * more than the slack (or the beam is past the visible line), else
+     * they take the slots nobody else wants. CPU and GPU alternate, and a
+     * CPU access waiting longer than the maximum wait goes before all. */
+    wire [15:0] arb_maxwait = arb_ctrl[15:0];
+    wire [10:0] arb_slack = arb_ctrl[26:16];
+    reg [15:0] arb_cpu_wait;
+    reg arb_gpu_turn;
+    reg [2:0] arb_clr_sr;
+    wire cpu_overdue = mem_s_valid && (arb_maxwait != 0) && (arb_cpu_wait >= arb_maxwait);
+    wire vdma_late = vdma_newline || (vdma_beam_x >= LCD_WIDTH);
+    wire vdma_urgent = vdma_due && (vdma_late || ({1'b0, vdma_next_x} + arb_slack <= vdma_beam_x));
+    wire ovl_urgent = ovl_due && (vdma_late || ({1'b0, ovl_next_x} + arb_slack <= vdma_beam_x));
+    wire vdma_take = (!cpu_overdue && (vdma_urgent || ovl_urgent)) ||
+                     (!mem_s_valid && !gpu_is_busy);
+    wire [9:0] vdma_srcline = CounterY >> scan_scale_l;
+    wire [22:0] vdma_newaddr = vdma_frameaddr + vdma_srcline * VDMA_LINEADDR_STRIDE;
+    wire [22:0] ovl_newaddr = ovl_addr_l + (CounterY - ovl_y0_l) * VDMA_LINEADDR_STRIDE;
 
     reg [1:0] gpu_cmd_sr;
-    reg gpu_setbg_start, gpu_setbg_cont;
     reg gpu_setpt_start;
     reg gpu_frect_start, gpu_frect_cont;
+    reg gpu_blit_start, gpu_blit_cont;
+    reg gpu_trap_start, gpu_trap_cont;
+    reg gpu_xf_start, gpu_xf_cont;
+    reg gpu_span_start, gpu_span_cont;
+
+    /* the clipped rect of the op, see the scissor below */
+    reg [15:0] x0_val, y0_val, x1_val, y1_val;
+    reg [15:0] srcx_val, srcy_val;
+
+    /* Every GPU op works on blocks of 32 bytes (16 pixels at 16bpp, 32 at
+     * 8bpp, 64 at 4bpp) and masks whole bytes, so with 4bpp x0 is rounded
+     * down and x1 up to even pixel pairs. data_mask bit k of a beat enables
+     * byte 2k, bit k+4 byte 2k+1. */
+    function [31:0] bytes_datamask(input [31:0] bm);
+        integer b;
+        begin
+            for (b = 0; b < 4; b = b + 1)
+                bytes_datamask[8*b+:8] = ~{bm[8*b+7], bm[8*b+5], bm[8*b+3], bm[8*b+1],
+                                           bm[8*b+6], bm[8*b+4], bm[8*b+2], bm[8*b]};
+        end
+    endfunction
 
-    wire [15:0] x0_val = x0y0_point[15:0];
-    wire [15:0] y0_val = x0y0_point[31:16];
-    wire [15:0] x1_val = x1y1_point[15:0];
-    wire [15:0] y1_val = x1y1_point[31:16];
-    
-    /* masks for line within a block of 16 pixels */
-    wire [15:0] pixmask_on[0:15], pixmask_off[0:15];
-
-    assign pixmask_on[0]  = 16'b1111_1111_1111_1111;
-    assign pixmask_on[1]  = 16'b1111_1111_1111_1110;
-    assign pixmask_on[2]  = 16'b1111_1111_1111_1100;
-    assign pixmask_on[3]  = 16'b1111_1111_1111_1000;
-    assign pixmask_on[4]  = 16'b1111_1111_1111_0000;
-    assign pixmask_on[5]  = 16'b1111_1111_1110_0000;
-    assign pixmask_on[6]  = 16'b1111_1111_1100_0000;
-    assign pixmask_on[7]  = 16'b1111_1111_1000_0000;
-    assign pixmask_on[8]  = 16'b1111_1111_0000_0000;
-    assign pixmask_on[9]  = 16'b1111_1110_0000_0000;
-    assign pixmask_on[10] = 16'b1111_1100_0000_0000;
-    assign pixmask_on[11] = 16'b1111_1000_0000_0000;
-    assign pixmask_on[12] = 16'b1111_0000_0000_0000;
-    assign pixmask_on[13] = 16'b1110_0000_0000_0000;
-    assign pixmask_on[14] = 16'b1100_0000_0000_0000;
-    assign pixmask_on[15] = 16'b1000_0000_0000_0000;
-
-    assign pixmask_off[0]  = 16'b0000_0000_0000_0001;
-    assign pixmask_off[1]  = 16'b0000_0000_0000_0011;
-    assign pixmask_off[2]  = 16'b0000_0000_0000_0111;
-    assign pixmask_off[3]  = 16'b0000_0000_0000_1111;
-    assign pixmask_off[4]  = 16'b0000_0000_0001_1111;
-    assign pixmask_off[5]  = 16'b0000_0000_0011_1111;
-    assign pixmask_off[6]  = 16'b0000_0000_0111_1111;
-    assign pixmask_off[7]  = 16'b0000_0000_1111_1111;
-    assign pixmask_off[8]  = 16'b0000_0001_1111_1111;
-    assign pixmask_off[9]  = 16'b0000_0011_1111_1111;
-    assign pixmask_off[10] = 16'b0000_0111_1111_1111;
-    assign pixmask_off[11] = 16'b0000_1111_1111_1111;
-    assign pixmask_off[12] = 16'b0001_1111_1111_1111;
-    assign pixmask_off[13] = 16'b0011_1111_1111_1111;
-    assign pixmask_off[14] = 16'b0111_1111_1111_1111;
-    assign pixmask_off[15] = 16'b1111_1111_1111_1111;
-
-    function [15:0] pixmask(input [3:0] startpix, endpix);
+    function [31:0] blk_datamask(input [4:0] first, input [4:0] last);
+        integer b;
+        reg [31:0] bm;
         begin
-            pixmask = pixmask_on[startpix] & pixmask_off[endpix];
+            for (b = 0; b < 32; b = b + 1)
+                bm[b] = (b >= first) && (b <= last);
+            blk_datamask = bytes_datamask(bm);
         end
     endfunction
 
     reg  [15:0] curr_x;
     reg  [15:0] curr_y;
-    wire [22:0] curr_y_lineaddr = work_addr + curr_y * VDMA_LINEADDR_STRIDE;
-    /* be careful: memaddr is (x_pixs << 1), but is also in 4-byte alignment */
-    wire [22:0] curr_xy_blkaddr = (curr_y_lineaddr + ((curr_x << 1) & 16'b1111_1111_1110_0000)) >> 2;
+    /* address of line curr_y, set when an op starts, then stepped by the stride */
+    reg  [22:0] curr_y_lineaddr;
 
-    wire [ 3:0] curr_x0_bounded = ((curr_x >> 4) > (x0_val >> 4)) ? 0 : x0_val & 4'b1111;
-    wire [ 3:0] curr_x1_bounded = ((curr_x >> 4) < (x1_val >> 4)) ? 4'b1111 : x1_val & 4'b1111;
-    wire [15:0] ln = pixmask(curr_x0_bounded, curr_x1_bounded);
+    /* x positions in bytes of the line for the draw depth */
+    wire [16:0] cx_byte = {curr_x, 1'b0} >> draw_bpp;
+    wire [16:0] x0_byte = {x0_val, 1'b0} >> draw_bpp;
+    wire [16:0] x1_byte = ({x1_val, 1'b0} >> draw_bpp) | (draw_bpp == 2'd0);
+    wire [16:0] sx_byte = {srcx_val, 1'b0} >> draw_bpp;
+    wire [3:0] gpu_op = gpu_ctrl[4:1];
+    wire [15:0] fb_width = LCD_WIDTH >> fb_scale;
+    wire [15:0] fb_height = LCD_HEIGHT >> fb_scale;
+
+    /* Render target: {height, width} in pixels and the line strides in
+     * bytes {source, destination}, all 0 for the screen (2048 byte lines,
+     * only SETBG bound to fb_width x fb_height). Surfaces and strides are
+     * multiples of one PSRAM burst, so blocks and runs never wrap. */
+    wire [15:0] dst_stride = (gpu_stride[15:0] == 16'd0) ? 16'd2048 : gpu_stride[15:0];
+    wire [15:0] src_stride = (gpu_stride[31:16] == 16'd0) ? 16'd2048 : gpu_stride[31:16];
+    wire [15:0] surf_w = (target_size[15:0] != 16'd0) ? target_size[15:0] : fb_width;
+    wire [15:0] surf_h = (target_size[31:16] != 16'd0) ? target_size[31:16] : fb_height;
+    wire [17:0] line_px = ({2'b0, dst_stride} << draw_bpp) >> 1;
+    wire [15:0] line_xmax = (line_px > 18'h8000) ? 16'h7fff : line_px[15:0] - 1'b1;
+    wire [15:0] tgt_xmax = ((gpu_op == 4'd1 || target_size[15:0] != 16'd0) &&
+                            (surf_w - 1'b1 < line_xmax)) ? surf_w - 1'b1 : line_xmax;
+    wire [15:0] tgt_ymax = (gpu_op == 4'd1 || target_size[31:16] != 16'd0) ?
+                           surf_h - 1'b1 : 16'h7fff;
+
+    /* Scissor: an op is clipped when it starts, to the scissor rect, to
+     * x, y >= 0 and to the target (its line at least); SETBG clears it and
+     * SPANS clips every span of its list to it.
+     * Coordinates are signed. The op then runs on the clipped rect (a blit
+     * moves its source along), an empty one does not start. The rect is
+     * taken while no op runs, so it is settled by the time the start edge
+     * has crossed over from the CPU clock. */
+    function signed [16:0] smax(input signed [16:0] a, input signed [16:0] b);
+        smax = (a > b) ? a : b;
+    endfunction
+
+    function signed [16:0] smin(input signed [16:0] a, input signed [16:0] b);
+        smin = (a < b) ? a : b;
+    endfunction
+
+    wire signed [16:0] clip_x0 = {clip_x0y0[15], clip_x0y0[15:0]};
+    wire signed [16:0] clip_y0 = {clip_x0y0[31], clip_x0y0[31:16]};
+    wire signed [16:0] clip_x1 = {clip_x1y1[15], clip_x1y1[15:0]};
+    wire signed [16:0] clip_y1 = {clip_x1y1[31], clip_x1y1[31:16]};
+    wire signed [16:0] lim_x = {1'b0, tgt_xmax};
+    wire signed [16:0] lim_y = {1'b0, tgt_ymax};
+    wire in_whole = (gpu_op == 4'd1) || (gpu_op == 4'd11);
+    wire signed [16:0] in_x0 = in_whole ? 17'sd0 : {x0y0_point[15], x0y0_point[15:0]};
+    wire signed [16:0] in_y0 = in_whole ? 17'sd0 : {x0y0_point[31], x0y0_point[31:16]};
+    wire signed [16:0] in_x1 = in_whole ? lim_x : (gpu_op == 4'd2) ? in_x0 :
+                               {x1y1_point[15], x1y1_point[15:0]};
+    wire signed [16:0] in_y1 = in_whole ? lim_y : (gpu_op == 4'd2) ? in_y0 :
+                               {x1y1_point[31], x1y1_point[31:16]};
+    wire signed [16:0] cut_x0 = smax(smax(in_x0, clip_x0), 17'sd0);
+    wire signed [16:0] cut_y0 = smax(smax(in_y0, clip_y0), 17'sd0);
+    wire signed [16:0] cut_x1 = smin(smin(in_x1, clip_x1), lim_x);
+    wire signed [16:0] cut_y1 = smin(smin(in_y1, clip_y1), lim_y);
+    wire cut_empty = (cut_x0 > cut_x1) || (cut_y0 > cut_y1);
+    wire [16:0] cut_dx = cut_x0 - in_x0;
+    wire [16:0] cut_dy = cut_y0 - in_y0;
+    wire [15:0] gpu_blkpix = 16'd16 << draw_bpp;
+    /* be careful: memaddr is in bytes, but is also in 4-byte alignment */
+    wire [22:0] curr_xy_blkaddr = (curr_y_lineaddr + {cx_byte[16:5], 5'b0}) >> 2;
+    wire gpu_lastblk = (cx_byte[16:5] >= x1_byte[16:5]);
+
+    /* SETBG and FRECT write a run of PSRAM_BLKS blocks per command, blocks
+     * of the run outside first..last are masked off */
+    function [7:0] run_beatmask(input [11:0] blk, input [1:0] beat,
+                                input [16:0] first, input [16:0] last);
+        reg [31:0] m;
+        begin
+            m = blk_datamask((blk == first[16:5]) ? first[4:0] : 5'd0,
+                             (blk == last[16:5]) ? last[4:0] : 5'd31);
+            run_beatmask = (blk < first[16:5] || blk > last[16:5]) ? 8'hff : m[8*beat+:8];
+        end
+    endfunction
+
+    wire [11:0] run_blk = cx_byte[16:5] & ~(PSRAM_BLKS - 1);
+    wire [22:0] curr_xy_runaddr = (curr_y_lineaddr + {run_blk, 5'b0}) >> 2;
+    wire [15:0] gpu_runpix = gpu_blkpix * PSRAM_BLKS;
+    wire [15:0] run_next_x = (curr_x + gpu_runpix) & ~(gpu_runpix - 1'b1);
+    wire gpu_lastrun = ({1'b0, run_blk} + PSRAM_BLKS - 1 >= x1_byte[16:5]);
+    /* beat whose data goes out next during a write command */
+    wire [7:0] wr_beat = cycle + 1'b1;
+    wire [11:0] wr_blk = run_blk + wr_beat[7:2];
+    wire [7:0] fill_beatmask = (wr_beat < PSRAM_BEATS) ?
+                               run_beatmask(wr_blk, wr_beat[1:0], x0_byte, x1_byte) : 8'hff;
+
+    wire [4:0] curr_x0_bounded = (cx_byte[16:5] > x0_byte[16:5]) ? 5'd0 : x0_byte[4:0];
+    wire [4:0] curr_x1_bounded = (cx_byte[16:5] < x1_byte[16:5]) ? 5'd31 : x1_byte[4:0];
+
+    wire [15:0] fill16 = (draw_bpp == 2'd0) ? rgb565 :
+                         (draw_bpp == 2'd1) ? {2{color_idx}} : {4{color_idx[3:0]}};
+    wire [63:0] wdata_allpix_rgb565 = {fill16, fill16, fill16, fill16};
+
+    /* Blit: source blocks are streamed in line order, blt_lo/blt_hi hold two
+     * neighbouring source blocks and every destination block is the window
+     * of 32 bytes starting at byte blt_shift of that pair. Because the
+     * window moves exactly one block per destination block, only one new
+     * source block is read per written block (plus one per line to prime). */
+    reg  [255:0] blt_lo, blt_hi;
+    reg  [191:0] blt_rd;
+    reg  [11:0] blt_sblk;
+    reg  blt_primed, blt_rdpend;
+    wire [4:0] blt_shift = sx_byte[4:0] - x0_byte[4:0];
+    /* first source block of a line, -1 when the source starts further into
+     * its block than the destination */
+    wire signed [12:0] blt_sx_first = {1'b0, sx_byte[11:0]} - {8'b0, x0_byte[4:0]};
+    wire [11:0] blt_sblk_first = blt_sx_first >>> 5;
+    reg  [22:0] blt_src_lineaddr;
+    wire [22:0] blt_src_blkaddr = (blt_src_lineaddr + {{6{blt_sblk[11]}}, blt_sblk, 5'b0}) >> 2;
+    wire [511:0] blt_pair = {blt_hi, blt_lo};
+    wire [255:0] blt_wdata = blt_pair >> {blt_shift, 3'b0};
+
+    /* Blend: FRECT_BLEND and BLIT_BLEND mix the color or the source over
+     * the destination with the alpha of argb (255 opaque), 16bpp only.
+     * They go block by block like a blit (the fill without source reads):
+     * the destination block is read, then written back blended, each beat
+     * mixed while the beat before goes out. Opaque or indexed they are
+     * plain FRECT and BLIT. */
+    reg  blt_fill, blt_blend, bld_rdpend;
+    reg  [255:0] bld_dst;
+    wire [8:0] bld_alpha = color_alpha + color_alpha[7];  /* 0..256 */
+    wire bld_on = (draw_bpp == 2'd0) && (color_alpha != 8'hff);
+    wire [255:0] bld_src = blt_fill ? {4{wdata_allpix_rgb565}} : blt_wdata;
+    /* beat that goes out next, 0 from the idle state */
+    wire [1:0] bld_beat = (state == 4'd0) ? 2'd0 : cycle[1:0] + 1'b1;
+
+    /* Gradient: GRADIENT fills x0y0/x1y1 (16bpp, else like FRECT) going
+     * block by block like a blended fill without the destination reads.
+     * t of a pixel is quadratic in x and y, so it is stepped with second
+     * order differences: per pixel along a line, per line along the first
+     * pixel. The op first walks them from 0, 0 to the first block of the
+     * rect, a cycle per pixel or line. t is clamped to 0..1 (2^28), for a
+     * radial gradient (t is the squared distance) through a square root,
+     * and weighs C1 over C0 in the mixer, optionally dithered. */
+    reg  blt_grad, grad_walk;
+    reg  [15:0] grad_wx, grad_wy;
+    reg  signed [47:0] grad_row, grad_drow, grad_col, grad_dcol, grad_t, grad_dt;
+    wire [23:0] grad_c0 = grad_params[23:0];
+    wire [23:0] grad_c1 = grad_params[55:32];
+    wire signed [47:0] grad_t0 = {grad_params[95:64], 16'b0};
+    wire signed [47:0] grad_tx = {{12{grad_params[127]}}, grad_params[127:96], 4'b0};
+    wire signed [47:0] grad_ty = {{12{grad_params[159]}}, grad_params[159:128], 4'b0};
+    wire signed [47:0] grad_q2 = {{15{grad_params[191]}}, grad_params[191:160], 1'b0};
+    wire grad_radial = grad_params[192];
+    wire grad_dither = grad_params[193];
+    wire [15:0] grad_xb = x0_val & ~16'd15;
+    /* t of the 4 pixels of the beat that goes out next */
+    wire signed [47:0] grad_t1 = grad_t + grad_dt;
+    wire signed [47:0] grad_t2 = grad_t1 + grad_dt + grad_q2;
+    wire signed [47:0] grad_t3 = grad_t2 + grad_dt + (grad_q2 <<< 1);
+
+    /* sqrt(f / 2^16) * 256: f is shifted by pairs of bits into 1/4..1,
+     * where two chords per octave stay within 1.3% */
+    function [8:0] sqrt_weight(input [16:0] f);
+        integer j;
+        reg [2:0] z;
+        reg [15:0] m;
+        reg [16:0] s;
+        begin
+            z = 0;
+            m = f[15:0];
+            for (j = 0; j < 7; j = j + 1)
+                if (m[15:14] == 2'b0) begin
+                    m = m << 2;
+                    z = z + 1'b1;
+                end
+            if (m[15])
+                s = 17'hb505 + (m[14:0] >> 1) + (m[14:0] >> 4) + (m[14:0] >> 6) + (m[14:0] >> 7);
+            else
+                s = 17'h8000 + (m[13:0] >> 1) + (m[13:0] >> 2) + (m[13:0] >> 4) + (m[13:0] >> 6);
+            sqrt_weight = f[16] ? 9'd256 : (f == 17'd0) ? 9'd0 : (s >> z) >> 8;
+        end
+    endfunction
+
+    function [8:0] grad_weight(input signed [47:0] t);
+        reg [16:0] f;
+        begin
+            f = (t < 0) ? 17'd0 : (t >= 48'sh1000_0000) ? 17'h10000 : {1'b0, t[27:12]};
+            grad_weight = grad_radial ? sqrt_weight(f) : f[16:8];
+        end
+    endfunction
+
+    /* Mixer: per 8-bit channel b + (o - b) * a / 256 (a 0..256), of 4
+     * pixels of RGB888 packed to RGB565 with a 4x4 ordered dither or
+     * truncated. */
+    function [23:0] rgb888(input [15:0] c);
+        rgb888 = {c[15:11], c[15:13], c[10:5], c[10:9], c[4:0], c[4:2]};
+    endfunction
+
+    function [95:0] beat888(input [63:0] c);
+        beat888 = {rgb888(c[63:48]), rgb888(c[47:32]), rgb888(c[31:16]), rgb888(c[15:0])};
+    endfunction
+
+    function [7:0] mix8(input [7:0] o, input [7:0] b, input [8:0] a);
+        reg signed [9:0] d;
+        reg signed [19:0] m;
+        begin
+            d    = {2'b0, o} - {2'b0, b};
+            m    = d * $signed({1'b0, a});
+            mix8 = b + m[15:8];
+        end
+    endfunction
+
+    function [3:0] bayer4(input [1:0] x, input [1:0] y);
+        case ({y, x})
+            4'h0: bayer4 = 4'd0; 4'h1: bayer4 = 4'd8; 4'h2: bayer4 = 4'd2; 4'h3: bayer4 = 4'd10;
+            4'h4: bayer4 = 4'd12; 4'h5: bayer4 = 4'd4; 4'h6: bayer4 = 4'd14; 4'h7: bayer4 = 4'd6;
+            4'h8: bayer4 = 4'd3; 4'h9: bayer4 = 4'd11; 4'ha: bayer4 = 4'd1; 4'hb: bayer4 = 4'd9;
+            4'hc: bayer4 = 4'd15; 4'hd: bayer4 = 4'd7; 4'he: bayer4 = 4'd13; 4'hf: bayer4 = 4'd5;
+        endcase
+    endfunction
+
+    function [15:0] pack565(input [23:0] c, input [3:0] th);
+        reg [8:0] r, g, b;
+        begin
+            r = c[23:16] + th[3:1];
+            g = c[15:8] + th[3:2];
+            b = c[7:0] + th[3:1];
+            pack565 = {r[8] ? 5'h1f : r[7:3], g[8] ? 6'h3f : g[7:2], b[8] ? 5'h1f : b[7:3]};
+        end
+    endfunction
+
+    /* pixel p of a beat is at x % 4 == p, 16bpp beats being 4-pixel aligned */
+    function [63:0] mix_beat(input [95:0] o, input [95:0] b, input [35:0] a,
+                             input dither, input [1:0] y);
+        integer p;
+        reg [23:0] c;
+        begin
+            for (p = 0; p < 4; p = p + 1) begin
+                c = {mix8(o[24*p+16+:8], b[24*p+16+:8], a[9*p+:9]),
+                     mix8(o[24*p+8+:8], b[24*p+8+:8], a[9*p+:9]),
+                     mix8(o[24*p+:8], b[24*p+:8], a[9*p+:9])};
+                mix_beat[16*p+:16] = pack565(c, dither ? bayer4(p, y) : 4'd0);
+            end
+        end
+    endfunction
+
+    wire [95:0] mix_o = blt_grad ? {4{grad_c1}} : beat888(bld_src[64*bld_beat+:64]);
+    wire [95:0] mix_b = blt_grad ? {4{grad_c0}} : beat888(bld_dst[64*bld_beat+:64]);
+    wire [35:0] mix_a = blt_grad ? {grad_weight(grad_t3), grad_weight(grad_t2),
+                                    grad_weight(grad_t1), grad_weight(grad_t)} : {4{bld_alpha}};
+    wire [63:0] mix_wdata = mix_beat(mix_o, mix_b, mix_a, blt_grad && grad_dither, curr_y[1:0]);
+    wire blt_mix = blt_blend || blt_grad;
+
+    /* Trapezoid (a triangle is two): lines y0..y1 of x0y0/x1y1 between a
+     * left and a right edge walked in 16.16, pixel x of a line is drawn
+     * when xl <= x < xr. x0y0/x1y1 are clipped like a filled rect and bound
+     * the spans, lines above the clip are only walked. Every span is set up
+     * in one idle cycle and written like a filled rect: flat ones in runs
+     * with the color, shaded ones (16bpp only) block by block with R, G, B
+     * in 8.8 starting at the left edge, stepped per line along it and per
+     * pixel across; the 4 pixels of a beat are computed while the beat
+     * before goes out. */
+    reg  trap_shade, trap_setup, trap_step;
+    reg  [15:0] trap_x0, trap_x1;
+    reg  [31:0] trap_xl, trap_xr;
+    reg  signed [19:0] trap_r, trap_g, trap_b;
+    reg  signed [19:0] shd_r, shd_g, shd_b;
+    wire [31:0] trap_dxl = trap_params[63:32];
+    wire [31:0] trap_dxr = trap_params[127:96];
+    wire signed [19:0] trap_drx = {{4{trap_params[159]}}, trap_params[159:144]};
+    wire signed [19:0] trap_dgx = {{4{trap_params[191]}}, trap_params[191:176]};
+    wire signed [19:0] trap_dbx = {{4{trap_params[223]}}, trap_params[223:208]};
+    wire signed [19:0] trap_dry = {{4{trap_params[239]}}, trap_params[239:224]};
+    wire signed [19:0] trap_dgy = {{4{trap_params[255]}}, trap_params[255:240]};
+    wire signed [19:0] trap_dby = {{4{trap_params[271]}}, trap_params[271:256]};
+    /* span of line curr_y: ceil(xl) .. ceil(xr) - 1, bounded */
+    wire [32:0] trap_xl_ceil = {trap_xl[31], trap_xl} + 33'h0ffff;
+    wire [32:0] trap_xr_ceil = {trap_xr[31], trap_xr} + 33'h0ffff;
+    wire signed [16:0] trap_xs = trap_xl_ceil[32:16];
+    wire signed [16:0] trap_xe = trap_xr_ceil[32:16] - 1'b1;
+    wire signed [16:0] span_x0 = smax(trap_xs, {1'b0, trap_x0});
+    wire signed [16:0] span_x1 = smin(trap_xe, {1'b0, trap_x1});
+    wire span_empty = (span_x0 > span_x1) || ($signed(curr_y) < $signed(y0_val));
+    /* shading starts at the first pixel of the span's first block */
+    wire signed [16:0] shd_off = {span_x0[16:4], 4'b0} - trap_xs;
+
+    /* 8.8 channel to 8 bits, saturated */
+    function [7:0] sat8(input signed [19:0] c);
+        sat8 = (c < 0) ? 8'd0 : (c > 20'sh0ffff) ? 8'hff : c[15:8];
+    endfunction
+
+    function [63:0] shade_beat(input signed [19:0] r, input signed [19:0] g,
+                               input signed [19:0] b);
+        integer p;
+        reg [7:0] r8, g8, b8;
+        begin
+            for (p = 0; p < 4; p = p + 1) begin
+                r8 = sat8(r + p * trap_drx);
+                g8 = sat8(g + p * trap_dgx);
+                b8 = sat8(b + p * trap_dbx);
+                shade_beat[16*p+:16] = {r8[7:3], g8[7:2], b8[7:3]};
+            end
+        end
+    endfunction
+
+    wire [63:0] shd_wdata = shade_beat(shd_r, shd_g, shd_b);
+    /* Transform blit: BLIT_XFORM fills x0y0/x1y1 with the nearest source
+     * pixels of an affine map, u = u0 + du/dx * x + du/dy * y and v alike
+     * in 16.16 of target x, y, clamped to 0..umax, 0..vmax: scales, flips
+     * and the 90 degree rotations, 16bpp only. The target is walked in
+     * bands of 16 lines, each band a column of blocks at a time, so a
+     * rotated band reads a source tile. Source blocks are kept in a cache
+     * of 32 (index v[3:0] and u[4], cleared per op, sources up to 2048 x
+     * 2048); the pixels of a block are gathered from it one per cycle and
+     * the block is written masked like a blit. A miss reads the source
+     * block, then gathering goes on. The op first walks u, v from 0, 0 to
+     * the first block, a cycle per pixel or line. */
+    reg  xf_walk, xf_miss, xf_full, xf_rdv, xf_cwe;
+    reg  [15:0] xf_wx, xf_wy;
+    reg  [3:0] xf_p, xf_rdp;
+    reg  [31:0] xf_bu, xf_bv, xf_cu, xf_cv, xf_lu, xf_lv, xf_pu, xf_pv;
+    reg  [15:0] xf_band_y0;
+    reg  [22:0] xf_band_lineaddr;
+    reg  [255:0] xf_blk;
+    reg  [31:0] xf_valid;
+    reg  [12:0] xf_tag[0:31];
+    reg  [4:0] xf_fidx;
+    reg  [12:0] xf_ftag;
+    reg  [6:0] xf_cwaddr;
+    reg  [63:0] xf_cwdata;
+    wire [31:0] xf_dudx = xf_params[95:64];
+    wire [31:0] xf_dvdx = xf_params[127:96];
+    wire [31:0] xf_dudy = xf_params[159:128];
+    wire [31:0] xf_dvdy = xf_params[191:160];
+    wire [10:0] xf_umax = xf_params[202:192];
+    wire [10:0] xf_vmax = xf_params[218:208];
+    wire [15:0] xf_xb = x0_val & ~16'd15;
+    wire [15:0] xf_band_y1 = (y1_val - xf_band_y0 > 16'd15) ? xf_band_y0 + 16'd15 : y1_val;
+    /* source pixel of pixel xf_p of the block */
+    wire [10:0] xf_u = xf_pu[31] ? 11'd0 : (xf_pu[30:16] > xf_umax) ? xf_umax : xf_pu[26:16];
+    wire [10:0] xf_v = xf_pv[31] ? 11'd0 : (xf_pv[30:16] > xf_vmax) ? xf_vmax : xf_pv[26:16];
+    wire [4:0] xf_cidx = {xf_v[3:0], xf_u[4]};
+    wire [12:0] xf_utag = {xf_v[10:4], xf_u[10:5]};
+    wire xf_hit = xf_valid[xf_cidx] && (xf_tag[xf_cidx] == xf_utag);
+    wire [15:0] xf_px = {curr_x[15:4], xf_p};
+    wire xf_pxin = (xf_px >= x0_val) && (xf_px <= x1_val);
+    wire [22:0] xf_src_blkaddr = (src_addr + xf_v * src_stride + {xf_u[10:4], 5'b0}) >> 2;
+    wire [15:0] xf_rdata;
+
+    FB_BlockCache xf_cache (
+        .clk(mclk_out),
+        .we(xf_cwe),
+        .waddr(xf_cwaddr),
+        .wdata(xf_cwdata),
+        .raddr({xf_cidx, xf_u[3:0]}),
+        .rdata(xf_rdata)
+    );
+
+    /* Span list: SPANS fills the spans of a list in PSRAM, one beat each
+     * {color, y, x1, x0} with x0..x1 inclusive and signed; color is RGB565
+     * (the index at 8/4bpp) when the op takes colors, else all spans are
+     * argb. The list is read a block of 4 entries at a time, every span is
+     * clipped to the scissor and target, set up in one idle cycle and
+     * written in runs like a flat trapezoid span. */
+    reg  spl_full, spl_draw;
+    reg  [1:0] spl_i;
+    reg  [15:0] spl_left;
+    reg  [22:0] spl_addr;
+    reg  [15:0] spl_cx0, spl_cx1;
+    reg  [15:0] spl_fill;
+    reg  [255:0] spl_buf;
+    wire spl_colors = span_params[63];
+    wire [63:0] spl_e = spl_buf[64*spl_i+:64];
+    wire signed [16:0] spl_x0 = smax({spl_e[15], spl_e[15:0]}, {1'b0, spl_cx0});
+    wire signed [16:0] spl_x1 = smin({spl_e[31], spl_e[31:16]}, {1'b0, spl_cx1});
+    wire signed [16:0] spl_y = {spl_e[47], spl_e[47:32]};
+    wire spl_empty = (spl_x0 > spl_x1) || (spl_y < $signed({1'b0, y0_val})) ||
+                     (spl_y > $signed({1'b0, y1_val}));
+    wire [15:0] spl_c16 = (draw_bpp == 2'd0) ? spl_e[63:48] :
+                          (draw_bpp == 2'd1) ? {2{spl_e[55:48]}} : {4{spl_e[51:48]}};
+    /* the entry is the last of the block or of the list */
+    wire spl_last = (spl_i == 2'd3) || (spl_left == 16'd1);
 
-    wire [63:0] wdata_allpix_rgb565 = {rgb565, rgb565, rgb565, rgb565};
     // verilog_format: off
     /* pixel point mask */
-    wire [15:0] pm = (1'b1 << x0_val[3:0]);
-    wire [63:0] pt_pixelmask32 = ~{ pm[15],pm[14],pm[13],pm[12],pm[15],pm[14],pm[13],pm[12],
-                                    pm[11],pm[10],pm[9], pm[8], pm[11],pm[10],pm[9], pm[8],
-                                    pm[7], pm[6], pm[5], pm[4], pm[7], pm[6], pm[5], pm[4],
-                                    pm[3], pm[2], pm[1], pm[0], pm[3], pm[2], pm[1], pm[0] };
+    wire [31:0] pt_pixelmask32 = blk_datamask(x0_byte[4:0], x0_byte[4:0] | (draw_bpp == 2'd0));
     /* line within block masking */
-    wire [63:0] ln_pixelmask32 = ~{ ln[15],ln[14],ln[13],ln[12],ln[15],ln[14],ln[13],ln[12],
-                                    ln[11],ln[10],ln[9], ln[8], ln[11],ln[10],ln[9], ln[8],
-                                    ln[7], ln[6], ln[5], ln[4], ln[7], ln[6], ln[5], ln[4],
-                                    ln[3], ln[2], ln[1], ln[0], ln[3], ln[2], ln[1], ln[0] };
-
-    assign gpu_is_busy = gpu_setbg_start | gpu_setbg_cont |
-                         gpu_setpt_start |
-                         gpu_frect_start | gpu_frect_cont;  
+    wire [31:0] ln_pixelmask32 = blk_datamask(curr_x0_bounded, curr_x1_bounded);
+
+    /* Plot port: stores of packed points {color[31:20], y[19:10], x[9:0]}
+     * queue up in plot_fifo. Consecutive points in the same block of the
+     * same line are merged into plot_data/plot_bytes and written with one
+     * masked command, the block is flushed when the next point falls
+     * elsewhere or the queue runs dry. The color is RGB444 at 16bpp, the
+     * palette index at 8/4bpp (4bpp sets the whole pixel pair, like
+     * SETPT). Points outside the surface are dropped. */
+    wire [31:0] plot_head;
+    wire plot_empty;
+    reg plot_acc, plot_issue;
+    reg [9:0] plot_y;
+    reg [22:0] plot_lineaddr;
+    reg [5:0] plot_blk;
+    reg [255:0] plot_data;
+    reg [31:0] plot_bytes;
+    wire [9:0] plot_hx = plot_head[9:0];
+    wire [9:0] plot_hy = plot_head[19:10];
+    wire [11:0] plot_hc = plot_head[31:20];
+    wire [10:0] plot_hbyte = {plot_hx, 1'b0} >> draw_bpp;
+    wire plot_hvalid = (plot_hx < surf_w) && (plot_hy < surf_h) && (plot_hx <= line_xmax) &&
+                       ($signed({7'b0, plot_hx}) >= clip_x0) &&
+                       ($signed({7'b0, plot_hx}) <= clip_x1) &&
+                       ($signed({7'b0, plot_hy}) >= clip_y0) &&
+                       ($signed({7'b0, plot_hy}) <= clip_y1);
+    wire plot_same = (plot_hy == plot_y) && (plot_hbyte[10:5] == plot_blk);
+    wire [15:0] plot_pix16 = (draw_bpp == 2'd0) ?
+                             {plot_hc[11:8], plot_hc[11], plot_hc[7:4], plot_hc[7:6],
+                              plot_hc[3:0], plot_hc[3]} :
+                             (draw_bpp == 2'd1) ? {2{plot_hc[7:0]}} : {4{plot_hc[3:0]}};
+    wire [31:0] plot_hbytes = (draw_bpp == 2'd0) ? (32'd3 << plot_hbyte[4:0]) :
+                                                   (32'd1 << plot_hbyte[4:0]);
+    wire plot_pop = !plot_empty && !plot_issue && (!plot_acc || plot_same || !plot_hvalid);
+    wire [31:0] plot_mask = bytes_datamask(plot_bytes);
+    wire [22:0] plot_blkaddr = (plot_lineaddr + {plot_blk, 5'b0}) >> 2;
+    wire plot_busy = !plot_empty || plot_acc;
+
+    /* DMA block port: a request toggles dma_req with its block held (the
+     * CPU clock is half of this one), the block is read or written whole
+     * with one command and dma_ack toggles back. It goes after the CPU,
+     * taking the CPU's turns against the GPU. */
+    reg [1:0] dma_req_sr;
+    reg dma_ack_r;
+    reg [255:0] dma_rd;
+    wire dma_pend = (dma_req_sr[1] != dma_ack_r);
+    wire [31:0] dma_mask = bytes_datamask(dma_wbytes);
+    assign dma_ack   = dma_ack_r;
+    assign dma_rdata = dma_rd;
+    integer pb;
+
+    FB_PlotFifo plot_fifo (
+        .wclk(clk),
+        .resetn(resetn),
+        .we(plot_we),
+        .wdata(plot_wdata),
+        .full(plot_full),
+
+        .rclk(mclk_out),
+        .re(plot_pop),
+        .rdata(plot_head),
+        .empty(plot_empty)
+    );
+
+    wire gpu_op_busy = gpu_setpt_start |
+                       gpu_frect_start | gpu_frect_cont |
+                       gpu_blit_start | gpu_blit_cont |
+                       gpu_trap_start | gpu_trap_cont |
+                       gpu_xf_start | gpu_xf_cont |
+                       gpu_span_start | gpu_span_cont;
+    assign gpu_is_busy = gpu_op_busy | plot_busy;
     // verilog_format: on
 
 
@@ -301,60 +949,250 @@ module PSRAM_FRAMEBUFFER_LCD (
             vdma_waitinc    <= 0;
             vdma_wdata      <= 0;
             vdma_start_sr   <= 0;
+            vdma_newline    <= 0;
+            arb_cpu_wait    <= 0;
+            arb_gpu_turn    <= 0;
+            arb_clr_sr      <= 0;
+            arb_cpu_waitmax <= 0;
+            arb_cpu_forced  <= 0;
+            arb_vdma_urgent <= 0;
+            vdma_late_cnt   <= 0;
+            vdma_under_cnt  <= 0;
+            vdma_stat       <= 0;
+            vdma_frames     <= 0;
+            vdma_line       <= 0;
             vdma_blkcnt     <= 0;
-            vdma_lineidx    <= 0;
+            ovl_wstrb       <= 0;
+            ovl_line        <= 0;
+            ovl_blkcnt      <= 0;
             gpu_cmd_sr      <= 0;
-            gpu_setbg_start <= 0;
-            gpu_setbg_cont  <= 0;
             gpu_setpt_start <= 0;
             gpu_frect_start <= 0;
             gpu_frect_cont  <= 0;
+            gpu_blit_start  <= 0;
+            gpu_blit_cont   <= 0;
+            gpu_trap_start  <= 0;
+            gpu_trap_cont   <= 0;
+            gpu_xf_start    <= 0;
+            gpu_xf_cont     <= 0;
+            gpu_span_start  <= 0;
+            gpu_span_cont   <= 0;
+            xf_walk         <= 0;
+            xf_cwe          <= 0;
+            blt_primed      <= 0;
+            blt_rdpend      <= 0;
+            blt_fill        <= 0;
+            blt_blend       <= 0;
+            bld_rdpend      <= 0;
+            blt_grad        <= 0;
+            grad_walk       <= 0;
+            plot_acc        <= 0;
+            plot_issue      <= 0;
+            plot_bursts     <= 0;
+            dma_req_sr      <= 0;
+            dma_ack_r       <= 0;
             curr_x          <= 0;
             curr_y          <= 0;
         end else begin
             vdma_start_sr = {vdma_start_sr[1:0], vdma_start};
+            vdma_beam_x <= CounterX;
             gpu_cmd_sr <= {gpu_cmd_sr[0], gpu_ctrl[0]};
-            if (gpu_cmd_sr[1:0] == 2'b01) begin
-                case (gpu_ctrl[4:1])
-                    1: begin
-                        gpu_setbg_start <= 1;
-                        curr_x          <= 0;
-                        curr_y          <= 0;
+            dma_req_sr <= {dma_req_sr[0], dma_req};
+            if (!gpu_op_busy) begin
+                x0_val   <= cut_x0[15:0];
+                y0_val   <= cut_y0[15:0];
+                x1_val   <= cut_x1[15:0];
+                y1_val   <= cut_y1[15:0];
+                srcx_val <= srcxy_point[15:0] + cut_dx[15:0];
+                srcy_val <= srcxy_point[31:16] + cut_dy[15:0];
+            end
+            if (gpu_cmd_sr[1:0] == 2'b01 && !cut_empty) begin
+                curr_x           <= x0_val;
+                curr_y           <= y0_val;
+                curr_y_lineaddr  <= work_addr + y0_val * dst_stride;
+                blt_src_lineaddr <= src_addr + srcy_val * src_stride;
+                case (gpu_op)
+                    1, 3: begin
+                        /* SETBG is a filled rect of the whole surface */
+                        gpu_frect_start <= 1;
                     end
                     2: begin
                         gpu_setpt_start <= 1;
-                        curr_x          <= x0_val;
-                        curr_y          <= y0_val;
                     end
-                    3: begin
-                        gpu_frect_start <= 1;
-                        curr_x          <= x0_val;
-                        curr_y          <= y0_val;
+                    4, 8: begin
+                        gpu_blit_start  <= 1;
+                        blt_sblk        <= blt_sblk_first;
+                        blt_primed      <= 0;
+                        blt_rdpend      <= 1;
+                        blt_fill        <= 0;
+                        blt_blend       <= (gpu_op == 4'd8) && bld_on;
+                        bld_rdpend      <= (gpu_op == 4'd8) && bld_on;
+                        blt_grad        <= 0;
+                    end
+                    7: begin
+                        /* a blended fill is a blit without source */
+                        if (bld_on) begin
+                            gpu_blit_start <= 1;
+                            blt_rdpend     <= 0;
+                            blt_fill       <= 1;
+                            blt_blend      <= 1;
+                            bld_rdpend     <= 1;
+                            blt_grad       <= 0;
+                        end else
+                            gpu_frect_start <= 1;
+                    end
+                    9: begin
+                        /* so is a gradient, after walking to its first block */
+                        if (draw_bpp == 2'd0) begin
+                            gpu_blit_start <= 1;
+                            blt_rdpend     <= 0;
+                            blt_fill       <= 1;
+                            blt_blend      <= 0;
+                            bld_rdpend     <= 0;
+                            blt_grad       <= 1;
+                            grad_walk      <= 1;
+                            grad_wx        <= 0;
+                            grad_wy        <= 0;
+                            grad_row       <= grad_t0;
+                            grad_drow      <= grad_ty + (grad_q2 >>> 1);
+                            grad_col       <= 0;
+                            grad_dcol      <= grad_tx + (grad_q2 >>> 1);
+                        end else
+                            gpu_frect_start <= 1;
+                    end
+                    5, 6: begin
+                        /* walked from its first line, even when clipped */
+                        gpu_trap_start  <= 1;
+                        trap_shade      <= (gpu_op == 4'd6) && (draw_bpp == 2'd0);
+                        trap_setup      <= 1;
+                        trap_step       <= 0;
+                        curr_y          <= in_y0[15:0];
+                        trap_x0         <= x0_val;
+                        trap_x1         <= x1_val;
+                        trap_xl         <= trap_params[31:0];
+                        trap_xr         <= trap_params[95:64];
+                        trap_r          <= {4'b0, trap_params[143:128]};
+                        trap_g          <= {4'b0, trap_params[175:160]};
+                        trap_b          <= {4'b0, trap_params[207:192]};
+                    end
+                    10: begin
+                        if (draw_bpp == 2'd0) begin
+                            gpu_xf_start     <= 1;
+                            xf_walk          <= 1;
+                            xf_wx            <= 0;
+                            xf_wy            <= 0;
+                            xf_bu            <= xf_params[31:0];
+                            xf_bv            <= xf_params[63:32];
+                            xf_p             <= 0;
+                            xf_miss          <= 0;
+                            xf_full          <= 0;
+                            xf_valid         <= 0;
+                            xf_band_y0       <= y0_val;
+                            xf_band_lineaddr <= work_addr + y0_val * dst_stride;
+                        end
+                    end
+                    11: begin
+                        /* x0y0/x1y1 are the clipped target, bounding the spans */
+                        gpu_span_start <= 1;
+                        spl_addr       <= {span_params[22:5], 5'b0};
+                        spl_left       <= span_params[47:32];
+                        spl_full       <= 0;
+                        spl_draw       <= 0;
+                        spl_cx0        <= x0_val;
+                        spl_cx1        <= x1_val;
                     end
                 endcase
             end
+            if (grad_walk) begin
+                /* t and its steps at the first pixel of the rect's line
+                 * (row) and at the first block of the rect (col) */
+                if (grad_wy != y0_val) begin
+                    grad_wy   <= grad_wy + 1'b1;
+                    grad_row  <= grad_row + grad_drow;
+                    grad_drow <= grad_drow + grad_q2;
+                end
+                if (grad_wx != grad_xb) begin
+                    grad_wx   <= grad_wx + 1'b1;
+                    grad_col  <= grad_col + grad_dcol;
+                    grad_dcol <= grad_dcol + grad_q2;
+                end
+                if (grad_wy == y0_val && grad_wx == grad_xb) begin
+                    grad_walk <= 0;
+                    grad_t    <= grad_row + grad_col;
+                    grad_dt   <= grad_dcol;
+                end
+            end
+            if (xf_walk) begin
+                /* u, v at the first block of the rect */
+                if (xf_wy != y0_val) begin
+                    xf_wy <= xf_wy + 1'b1;
+                    xf_bu <= xf_bu + xf_dudy;
+                    xf_bv <= xf_bv + xf_dvdy;
+                end else if (xf_wx != xf_xb) begin
+                    xf_wx <= xf_wx + 1'b1;
+                    xf_bu <= xf_bu + xf_dudx;
+                    xf_bv <= xf_bv + xf_dvdx;
+                end else begin
+                    xf_walk <= 0;
+                    xf_cu   <= xf_bu;
+                    xf_cv   <= xf_bv;
+                    xf_lu   <= xf_bu;
+                    xf_lv   <= xf_bv;
+                    xf_pu   <= xf_bu;
+                    xf_pv   <= xf_bv;
+                end
+            end
+            /* a gathered pixel arrives a cycle after its cache read */
+            xf_rdv <= 0;
+            if (xf_rdv)
+                xf_blk[16*xf_rdp+:16] <= xf_rdata;
             case (state)
                 default: begin
                     cycle      <= 0;
                     completed  <= 0;
                     vdma_wstrb <= 0;
+                    ovl_wstrb  <= 0;
+                    xf_cwe     <= 0;
 
-                    if (vdma_start_sr[2:1] == 2'b01) begin
+                    if (vdma_newline && !vdma_pend && !ovl_pend) begin
+                        vdma_newline <= 0;
                         if (CounterY < LCD_HEIGHT) begin
-                            // i.e. 0 < CounterY < 600
-                            state        <= 3;  // set to vdma_read_State
-                            addr_i       <= {vdma_lineaddr[22:11], 6'b0, 3'b0};
-                            data_mask_i  <= 'b0;
-                            read_count   <= 0;
-                            cmd_i        <= 0;
-                            cmd_en_i     <= 1;
-                            vdma_waitinc <= 0;
-                            vdma_blkcnt  <= 0;
+                            // i.e. 0 <= CounterY < 600, repeated lines of the
+                            // pixel-doubled modes keep their half and only
+                            // fetch the overlay
+                            vdma_line     <= (CounterY[1:0] & scan_repmask) == 0;
+                            vdma_bank     <= vdma_srcline[0];
+                            vdma_blkcnt   <= 0;
+                            vdma_lineaddr <= vdma_newaddr;
+                            ovl_line      <= ovl_on_l && (CounterY >= ovl_y0_l) &&
+                                             (CounterY <= ovl_y1_l);
+                            ovl_bank      <= CounterY[0];
+                            ovl_blkcnt    <= 0;
+                            ovl_lineaddr  <= ovl_newaddr;
                         end else begin
-                            vdma_lineidx  <= 0;
-                            vdma_lineaddr <= disp_addr;
+                            vdma_line <= 0;
+                            ovl_line  <= 0;
+                        end
+                        if (CounterYmaxed) begin
+                            vdma_frameaddr <= disp_addr;
+                            /* health of the frame just shown */
+                            vdma_stat      <= {vdma_under_cnt, vdma_late_cnt};
+                            vdma_late_cnt  <= 0;
+                            vdma_under_cnt <= 0;
+                            vdma_frames    <= vdma_frames + 1'b1;
                         end
-                    end else if (vdma_blkcnt > 0 && vdma_blkcnt < VDMA_MAXBLKCNT) begin
+                    end else if (vdma_take && ovl_due && (!vdma_due || ovl_next_x < vdma_next_x)) begin
+                        if (ovl_urgent && !arb_vdma_urgent[31])
+                            arb_vdma_urgent <= arb_vdma_urgent + 1'b1;
+                        state        <= 9;  // set to overlay vdma_read state
+                        addr_i       <= {ovl_lineaddr[22:11], ovl_blkcnt[5:0], 3'b0};
+                        data_mask_i  <= 'b0;
+                        read_count   <= 0;
+                        cmd_i        <= 0;
+                        cmd_en_i     <= 1;
+                    end else if (vdma_take && vdma_due) begin
+                        if (vdma_urgent && !arb_vdma_urgent[31])
+                            arb_vdma_urgent <= arb_vdma_urgent + 1'b1;
                         state        <= 3;  // set to vdma_read_State
                         addr_i       <= {vdma_lineaddr[22:11], vdma_blkcnt[5:0], 3'b0};
                         data_mask_i  <= 'b0;
@@ -362,7 +1200,12 @@ module PSRAM_FRAMEBUFFER_LCD (
                         cmd_i        <= 0;
                         cmd_en_i     <= 1;
                         vdma_waitinc <= 0;
-                    end else if (mem_s_valid) begin
+                    end else if (mem_s_valid && (cpu_overdue || !gpu_is_busy || !arb_gpu_turn)) begin
+                        arb_gpu_turn <= 1;
+                        if (arb_cpu_wait > arb_cpu_waitmax)
+                            arb_cpu_waitmax <= arb_cpu_wait;
+                        if (cpu_overdue && arb_cpu_forced != 16'hFFFF)
+                            arb_cpu_forced <= arb_cpu_forced + 1'b1;
                         if (mem_s_wstrb != 0) begin
                             /* First cycle of write setup: because the CPU only
                              * writes 32-bit words, only the first setted-up
@@ -379,26 +1222,42 @@ module PSRAM_FRAMEBUFFER_LCD (
                              * of the burst are read back, but only the relevant
                              * one-readcycle is given back to the CPU. */
                             state        <= 2;  // set to read_State
-                            addr_i[20:0] <= (mem_s_addr[22:2] & 21'b1_1111_1111_1111_1111_1000);
+                            addr_i[20:0] <= mem_s_addr[22:2] & ~(PSRAM_BEATS * 2 - 1);
                             data_mask_i  <= 'b0;
                             read_count   <= 0;
                             cmd_i        <= 0;
                             cmd_en_i     <= 1;
                         end
-                    end else if (gpu_setbg_start || gpu_setbg_cont) begin
-                        /* same like PSRAM write, but setup to write bgcolor */
-                        state           <= 4;
-                        gpu_setbg_start <= 0;
-                        if (gpu_setbg_start) begin
-                            gpu_setbg_cont  <= 1;
+                    end else if (dma_pend && (!gpu_is_busy || !arb_gpu_turn)) begin
+                        arb_gpu_turn <= 1;
+                        addr_i       <= dma_addr >> 2;
+                        cmd_en_i     <= 1;
+                        if (dma_we) begin
+                            state       <= 16;
+                            wrdata_i    <= dma_wdata[63:0];
+                            data_mask_i <= dma_mask[7:0];
+                            cmd_i       <= 1;
+                        end else begin
+                            state       <= 17;
+                            data_mask_i <= 'b0;
+                            read_count  <= 0;
+                            cmd_i       <= 0;
                         end
-                        wrdata_i <= wdata_allpix_rgb565;
-                        data_mask_i <= 8'h00;
-                        addr_i <= curr_xy_blkaddr;
-                        cmd_i <= 1;
-                        cmd_en_i <= 1;
+                    end else if (plot_acc && !plot_issue && !plot_pop) begin
+                        /* plot port: write the merged block, before any
+                         * GPU op started after its points were queued */
+                        state        <= 10;
+                        arb_gpu_turn <= 0;
+                        plot_issue   <= 1;
+                        plot_bursts  <= plot_bursts + 1'b1;
+                        wrdata_i     <= plot_data[63:0];
+                        data_mask_i  <= plot_mask[7:0];
+                        addr_i       <= plot_blkaddr;
+                        cmd_i        <= 1;
+                        cmd_en_i     <= 1;
                     end else if (gpu_setpt_start) begin
                         state <= 5;
+                        arb_gpu_turn <= 0;
                         gpu_setpt_start <= 0;
                         wrdata_i <= wdata_allpix_rgb565;
                         data_mask_i <= pt_pixelmask32[7:0];
@@ -407,16 +1266,168 @@ module PSRAM_FRAMEBUFFER_LCD (
                         cmd_en_i <= 1;
                     end else if (gpu_frect_start || gpu_frect_cont) begin
                         state <= 6;
+                        arb_gpu_turn <= 0;
                         gpu_frect_start <= 0;
                         if (gpu_frect_start) begin
                             gpu_frect_cont <= 1;
                         end
                         wrdata_i <= wdata_allpix_rgb565;
-                        data_mask_i	<= ln_pixelmask32[7:0];
-                        addr_i <= curr_xy_blkaddr;
+                        data_mask_i	<= run_beatmask(run_blk, 2'd0, x0_byte, x1_byte);
+                        addr_i <= curr_xy_runaddr;
                         cmd_i <= 1;
                         cmd_en_i <= 1;
-                    end 
+                    end else if ((gpu_blit_start || gpu_blit_cont) && !grad_walk) begin
+                        arb_gpu_turn   <= 0;
+                        gpu_blit_start <= 0;
+                        if (gpu_blit_start) begin
+                            gpu_blit_cont <= 1;
+                        end
+                        if (blt_rdpend) begin
+                            /* fetch the next source block */
+                            state       <= 7;
+                            addr_i      <= blt_src_blkaddr;
+                            data_mask_i <= 'b0;
+                            read_count  <= 0;
+                            cmd_i       <= 0;
+                            cmd_en_i    <= 1;
+                        end else if (bld_rdpend) begin
+                            /* fetch the destination block to blend over */
+                            state       <= 12;
+                            addr_i      <= curr_xy_blkaddr;
+                            data_mask_i <= 'b0;
+                            read_count  <= 0;
+                            cmd_i       <= 0;
+                            cmd_en_i    <= 1;
+                        end else begin
+                            state       <= 8;
+                            wrdata_i    <= blt_mix ? mix_wdata : blt_wdata[63:0];
+                            data_mask_i <= ln_pixelmask32[7:0];
+                            addr_i      <= curr_xy_blkaddr;
+                            cmd_i       <= 1;
+                            cmd_en_i    <= 1;
+                            grad_t      <= grad_t3 + grad_dt + grad_q2 + (grad_q2 <<< 1);
+                            grad_dt     <= grad_dt + (grad_q2 <<< 2);
+                        end
+                    end else if (gpu_trap_start || gpu_trap_cont) begin
+                        gpu_trap_start <= 0;
+                        if (gpu_trap_start) begin
+                            gpu_trap_cont <= 1;
+                        end
+                        if (trap_step) begin
+                            /* next line, the address only moves once inside the clip */
+                            trap_step  <= 0;
+                            trap_setup <= 1;
+                            if ($signed(curr_y) >= $signed(y1_val))
+                                gpu_trap_cont <= 0;
+                            if ($signed(curr_y) >= $signed(y0_val))
+                                curr_y_lineaddr <= curr_y_lineaddr + dst_stride;
+                            curr_y  <= curr_y + 1'b1;
+                            trap_xl <= trap_xl + trap_dxl;
+                            trap_xr <= trap_xr + trap_dxr;
+                            trap_r  <= trap_r + trap_dry;
+                            trap_g  <= trap_g + trap_dgy;
+                            trap_b  <= trap_b + trap_dby;
+                        end else if (trap_setup) begin
+                            if (span_empty)
+                                trap_step <= 1;
+                            else begin
+                                trap_setup <= 0;
+                                x0_val     <= span_x0[15:0];
+                                x1_val     <= span_x1[15:0];
+                                curr_x     <= span_x0[15:0];
+                                shd_r      <= trap_r + shd_off * trap_drx;
+                                shd_g      <= trap_g + shd_off * trap_dgx;
+                                shd_b      <= trap_b + shd_off * trap_dbx;
+                            end
+                        end else if (!trap_shade) begin
+                            state        <= 6;
+                            arb_gpu_turn <= 0;
+                            wrdata_i     <= wdata_allpix_rgb565;
+                            data_mask_i  <= run_beatmask(run_blk, 2'd0, x0_byte, x1_byte);
+                            addr_i       <= curr_xy_runaddr;
+                            cmd_i        <= 1;
+                            cmd_en_i     <= 1;
+                        end else begin
+                            state        <= 11;
+                            arb_gpu_turn <= 0;
+                            wrdata_i     <= shd_wdata;
+                            data_mask_i  <= ln_pixelmask32[7:0];
+                            addr_i       <= curr_xy_blkaddr;
+                            cmd_i        <= 1;
+                            cmd_en_i     <= 1;
+                            shd_r        <= shd_r + (trap_drx <<< 2);
+                            shd_g        <= shd_g + (trap_dgx <<< 2);
+                            shd_b        <= shd_b + (trap_dbx <<< 2);
+                        end
+                    end else if ((gpu_xf_start || gpu_xf_cont) && !xf_walk) begin
+                        gpu_xf_start <= 0;
+                        if (gpu_xf_start) begin
+                            gpu_xf_cont <= 1;
+                        end
+                        if (xf_miss) begin
+                            /* fetch the missing source block into the cache */
+                            state        <= 14;
+                            arb_gpu_turn <= 0;
+                            xf_miss      <= 0;
+                            addr_i       <= xf_src_blkaddr;
+                            data_mask_i  <= 'b0;
+                            read_count   <= 0;
+                            cmd_i        <= 0;
+                            cmd_en_i     <= 1;
+                        end else if (xf_full) begin
+                            state        <= 4;
+                            arb_gpu_turn <= 0;
+                            xf_full      <= 0;
+                            wrdata_i     <= xf_blk[63:0];
+                            data_mask_i  <= ln_pixelmask32[7:0];
+                            addr_i       <= curr_xy_blkaddr;
+                            cmd_i        <= 1;
+                            cmd_en_i     <= 1;
+                        end else
+                            state <= 13;
+                    end else if (gpu_span_start || gpu_span_cont) begin
+                        gpu_span_start <= 0;
+                        if (gpu_span_start) begin
+                            gpu_span_cont <= 1;
+                        end
+                        if (!spl_full) begin
+                            if (spl_left == 16'd0)
+                                gpu_span_cont <= 0;
+                            else begin
+                                /* fetch the next block of entries */
+                                state        <= 15;
+                                arb_gpu_turn <= 0;
+                                spl_addr     <= spl_addr + 23'd32;
+                                addr_i       <= spl_addr >> 2;
+                                data_mask_i  <= 'b0;
+                                read_count   <= 0;
+                                cmd_i        <= 0;
+                                cmd_en_i     <= 1;
+                            end
+                        end else if (!spl_draw) begin
+                            if (spl_empty) begin
+                                spl_i    <= spl_i + 1'b1;
+                                spl_left <= spl_left - 1'b1;
+                                spl_full <= !spl_last;
+                            end else begin
+                                spl_draw        <= 1;
+                                x0_val          <= spl_x0[15:0];
+                                x1_val          <= spl_x1[15:0];
+                                curr_x          <= spl_x0[15:0];
+                                curr_y          <= spl_y[15:0];
+                                curr_y_lineaddr <= work_addr + spl_y[15:0] * dst_stride;
+                                spl_fill        <= spl_colors ? spl_c16 : fill16;
+                            end
+                        end else begin
+                            state        <= 6;
+                            arb_gpu_turn <= 0;
+                            wrdata_i     <= {4{spl_fill}};
+                            data_mask_i  <= run_beatmask(run_blk, 2'd0, x0_byte, x1_byte);
+                            addr_i       <= curr_xy_runaddr;
+                            cmd_i        <= 1;
+                            cmd_en_i     <= 1;
+                        end
+                    end
                 end
                 1: begin  /* PSRAM write state */
                     cmd_en_i <= 0;
@@ -426,7 +1437,7 @@ module PSRAM_FRAMEBUFFER_LCD (
                             // stop writing after the first 32-bit word
                             data_mask_i <= 8'hff;
                         end
-                        13: begin
+                        PSRAM_TCMD - 1: begin
                             // IPUG 943 - Table 4-2, Tcmd is 14 when burst == 16
                             completed <= 1;
                             cycle     <= 0;
@@ -453,46 +1464,19 @@ module PSRAM_FRAMEBUFFER_LCD (
                     cycle    <= cycle + 1'b1;
                     if (rd_data_valid) begin
                         read_count <= read_count + 1'b1;
-                        vdma_waddr <= {vdma_blkcnt[5:0], read_count[1:0]};
+                        vdma_waddr <= {vdma_bank, vdma_run_waddr};
                         vdma_wdata <= rd_data;
                         vdma_wstrb <= 1'b1;
-                        if (read_count == 7'd3) begin
+                        if (read_count == PSRAM_BEATS - 1) begin
                             state <= 0;
-                            if (vdma_blkcnt == (VDMA_MAXBLKCNT - 1)) begin
-                                // Note to self: don't increment vmda_lineaddr at
-                                // VDMA_BLK size, let vdma_blkcnt do that, because
-                                // eventually going to use this with a FIFO instead
-                                // of DPB mem.
-                                vdma_lineaddr <= vdma_lineaddr + VDMA_LINEADDR_STRIDE;
-                                vdma_lineidx  <= vdma_lineidx + 1'b1;
-                            end
-                            vdma_blkcnt  <= vdma_blkcnt + 1'b1;
+                            if (vdma_newline && vdma_next_x <= vdma_beam_x &&
+                                vdma_under_cnt != 16'hFFFF)
+                                vdma_under_cnt <= vdma_under_cnt + 1'b1;
+                            vdma_blkcnt  <= vdma_blkcnt + PSRAM_BLKS;
                             vdma_waitinc <= 1;
                         end
                     end
                 end
-                4: begin
-                    /* gpu_setbg: same like PSRAM write state but write mem with bgcolor */
-                    cmd_en_i <= 0;
-                    cycle    <= cycle + 1'b1;
-                    /* turn off gpu_setbg_cont when limits are reached, but can
-                     * still continue on state 4 until end of block-write */
-                    if (curr_x >= ((LCD_WIDTH - 1) & 16'b1111_1111_1111_0000) && curr_y >= (LCD_HEIGHT - 1)) begin
-                        gpu_setbg_cont  <= 0;
-                    end
-                    case (cycle)
-                         13: begin
-                            cycle <= 0;
-                            state <= 0;
-                            if (curr_x < ((LCD_WIDTH - 1) & 16'b1111_1111_1111_0000))
-                                curr_x <= curr_x + 16'd16;
-                            else begin
-                                curr_x <= 0;
-                                curr_y <= curr_y + 1'b1;
-                            end
-                        end
-                    endcase
-                end
                 5: begin
                     /* draw a point from x0y0_reg with color_reg
                      * this will serve as a test of (a) calculating lineaddr from Y0
@@ -505,7 +1489,7 @@ module PSRAM_FRAMEBUFFER_LCD (
                         1: data_mask_i <= pt_pixelmask32[23:16];
                         2: data_mask_i <= pt_pixelmask32[31:24];
                         default: data_mask_i <= 8'hff;
-                        13: begin
+                        PSRAM_TCMD - 1: begin
                             cycle           <= 0;
                             state           <= 0;
                             gpu_setpt_start <= 0;
@@ -513,58 +1497,439 @@ module PSRAM_FRAMEBUFFER_LCD (
                     endcase
                 end
                 6: begin
-                    /* draw a filled rect from x0y0_reg to x1y1_reg with color_reg */
+                    /* draw a filled rect from x0y0_reg to x1y1_reg with color_reg,
+                     * or one flat trapezoid or list span */
                     cmd_en_i <= 0;
                     cycle    <= cycle + 1'b1;
-                    if (curr_x >= (x1_val & 16'b1111_1111_1111_0000) && curr_y >= (y1_val)) begin
+                    if (gpu_lastrun && curr_y >= (y1_val)) begin
                         gpu_frect_cont  <= 0;
                     end
                     case (cycle)
-                        0: data_mask_i <= ln_pixelmask32[15:8];
-                        1: data_mask_i <= ln_pixelmask32[23:16];
-                        2: data_mask_i <= ln_pixelmask32[31:24];
+                        default:
+                            data_mask_i <= fill_beatmask;
+                        PSRAM_TCMD - 1: begin
+                            cycle <= 0;
+                            state <= 0;
+                            if (!gpu_lastrun)
+                                curr_x <= run_next_x;
+                            else if (gpu_trap_cont)
+                                trap_step <= 1;
+                            else if (gpu_span_cont) begin
+                                spl_draw <= 0;
+                                spl_i    <= spl_i + 1'b1;
+                                spl_left <= spl_left - 1'b1;
+                                spl_full <= !spl_last;
+                            end else begin
+                                curr_x          <= x0_val;
+                                curr_y          <= curr_y + 1'b1;
+                                curr_y_lineaddr <= curr_y_lineaddr + dst_stride;
+                            end
+                        end
+                    endcase
+                end
+                7: begin
+                    /* gpu_blit: read one source block into blt_hi */
+                    cmd_en_i <= 0;
+                    if (rd_data_valid) begin
+                        read_count <= read_count + 1'b1;
+                        /* the block is the first 4 beats, the rest of a
+                         * longer burst is dropped */
+                        case (read_count)
+                            0: blt_rd[63:0]    <= rd_data;
+                            1: blt_rd[127:64]  <= rd_data;
+                            2: blt_rd[191:128] <= rd_data;
+                            3: begin
+                                blt_lo     <= blt_hi;
+                                blt_hi     <= {rd_data, blt_rd};
+                                blt_sblk   <= blt_sblk + 1'b1;
+                                /* the first block of a line only primes blt_hi */
+                                blt_primed <= 1;
+                                blt_rdpend <= ~blt_primed;
+                            end
+                        endcase
+                        if (read_count == PSRAM_BEATS - 1)
+                            state <= 0;
+                    end
+                end
+                9: begin  /* Overlay line PSRAM-to-linebuf read state */
+                    cmd_en_i <= 0;
+                    if (rd_data_valid) begin
+                        read_count <= read_count + 1'b1;
+                        vdma_waddr <= {ovl_bank, ovl_run_waddr};
+                        vdma_wdata <= rd_data;
+                        ovl_wstrb  <= 1'b1;
+                        if (read_count == PSRAM_BEATS - 1) begin
+                            state      <= 0;
+                            if (vdma_newline && ovl_next_x <= vdma_beam_x &&
+                                vdma_under_cnt != 16'hFFFF)
+                                vdma_under_cnt <= vdma_under_cnt + 1'b1;
+                            ovl_blkcnt <= ovl_blkcnt + PSRAM_BLKS;
+                        end
+                    end
+                end
+                8: begin
+                    /* gpu_blit: write the shifted source window (or the
+                     * blend) to the destination block, masked like a
+                     * filled rect */
+                    cmd_en_i <= 0;
+                    cycle    <= cycle + 1'b1;
+                    if (gpu_lastblk && curr_y >= (y1_val)) begin
+                        gpu_blit_cont <= 0;
+                    end
+                    case (cycle)
+                        0: begin
+                            wrdata_i    <= blt_mix ? mix_wdata : blt_wdata[127:64];
+                            data_mask_i <= ln_pixelmask32[15:8];
+                            grad_t      <= grad_t3 + grad_dt + grad_q2 + (grad_q2 <<< 1);
+                            grad_dt     <= grad_dt + (grad_q2 <<< 2);
+                        end
+                        1: begin
+                            wrdata_i    <= blt_mix ? mix_wdata : blt_wdata[191:128];
+                            data_mask_i <= ln_pixelmask32[23:16];
+                            grad_t      <= grad_t3 + grad_dt + grad_q2 + (grad_q2 <<< 1);
+                            grad_dt     <= grad_dt + (grad_q2 <<< 2);
+                        end
+                        2: begin
+                            wrdata_i    <= blt_mix ? mix_wdata : blt_wdata[255:192];
+                            data_mask_i <= ln_pixelmask32[31:24];
+                            grad_t      <= grad_t3 + grad_dt + grad_q2 + (grad_q2 <<< 1);
+                            grad_dt     <= grad_dt + (grad_q2 <<< 2);
+                        end
+                        default:
+                            data_mask_i <= 8'hff;
+                        PSRAM_TCMD - 1: begin
+                            cycle      <= 0;
+                            state      <= 0;
+                            blt_rdpend <= !blt_fill;
+                            bld_rdpend <= blt_blend;
+                            if (!gpu_lastblk)
+                                curr_x <= curr_x + gpu_blkpix;
+                            else begin
+                                curr_x           <= x0_val;
+                                curr_y           <= curr_y + 1'b1;
+                                curr_y_lineaddr  <= curr_y_lineaddr + dst_stride;
+                                blt_src_lineaddr <= blt_src_lineaddr + src_stride;
+                                blt_sblk         <= blt_sblk_first;
+                                blt_primed       <= 0;
+                                grad_row         <= grad_row + grad_drow;
+                                grad_drow        <= grad_drow + grad_q2;
+                                grad_t           <= grad_row + grad_drow + grad_col;
+                                grad_dt          <= grad_dcol;
+                            end
+                        end
+                    endcase
+                end
+                10: begin
+                    /* plot port: the other beats of the merged block */
+                    cmd_en_i <= 0;
+                    cycle    <= cycle + 1'b1;
+                    case (cycle)
+                        0: begin
+                            wrdata_i    <= plot_data[127:64];
+                            data_mask_i <= plot_mask[15:8];
+                        end
+                        1: begin
+                            wrdata_i    <= plot_data[191:128];
+                            data_mask_i <= plot_mask[23:16];
+                        end
+                        2: begin
+                            wrdata_i    <= plot_data[255:192];
+                            data_mask_i <= plot_mask[31:24];
+                        end
                         default:
                             data_mask_i <= 8'hff;
-                        13: begin
+                        PSRAM_TCMD - 1: begin
+                            cycle      <= 0;
+                            state      <= 0;
+                            plot_acc   <= 0;
+                            plot_issue <= 0;
+                        end
+                    endcase
+                end
+                16: begin
+                    /* DMA block port: the other beats of the block */
+                    cmd_en_i <= 0;
+                    cycle    <= cycle + 1'b1;
+                    case (cycle)
+                        0, 1, 2: begin
+                            wrdata_i    <= dma_wdata[64*cycle+64+:64];
+                            data_mask_i <= dma_mask[8*cycle+8+:8];
+                        end
+                        default:
+                            data_mask_i <= 8'hff;
+                        PSRAM_TCMD - 1: begin
+                            cycle     <= 0;
+                            state     <= 0;
+                            dma_ack_r <= ~dma_ack_r;
+                        end
+                    endcase
+                end
+                17: begin
+                    /* DMA block port: read the block, dropping the rest of a
+                     * longer burst */
+                    cmd_en_i <= 0;
+                    if (rd_data_valid) begin
+                        read_count <= read_count + 1'b1;
+                        if (read_count < 4)
+                            dma_rd[64*read_count[1:0]+:64] <= rd_data;
+                        if (read_count == PSRAM_BEATS - 1) begin
+                            state     <= 0;
+                            dma_ack_r <= ~dma_ack_r;
+                        end
+                    end
+                end
+                12: begin
+                    /* blend: read the destination block into bld_dst */
+                    cmd_en_i <= 0;
+                    if (rd_data_valid) begin
+                        read_count <= read_count + 1'b1;
+                        case (read_count)
+                            0: bld_dst[63:0]    <= rd_data;
+                            1: bld_dst[127:64]  <= rd_data;
+                            2: bld_dst[191:128] <= rd_data;
+                            3: begin
+                                bld_dst[255:192] <= rd_data;
+                                bld_rdpend       <= 0;
+                            end
+                        endcase
+                        if (read_count == PSRAM_BEATS - 1)
+                            state <= 0;
+                    end
+                end
+                13: begin
+                    /* transform blit: gather the pixels of a block from the
+                     * cache, one per cycle, until a miss or the block is full */
+                    if (!xf_pxin || xf_hit) begin
+                        xf_rdv <= xf_pxin;
+                        xf_rdp <= xf_p;
+                        xf_p   <= xf_p + 1'b1;
+                        xf_pu  <= xf_pu + xf_dudx;
+                        xf_pv  <= xf_pv + xf_dvdx;
+                        if (xf_p == 4'd15) begin
+                            xf_full <= 1;
+                            state   <= 0;
+                        end
+                    end else begin
+                        xf_miss <= 1;
+                        xf_fidx <= xf_cidx;
+                        xf_ftag <= xf_utag;
+                        state   <= 0;
+                    end
+                end
+                14: begin
+                    /* transform blit: read a source block into the cache */
+                    cmd_en_i <= 0;
+                    xf_cwe   <= 0;
+                    if (rd_data_valid) begin
+                        read_count <= read_count + 1'b1;
+                        xf_cwe     <= (read_count < 4);
+                        xf_cwaddr  <= {xf_fidx, read_count[1:0]};
+                        xf_cwdata  <= rd_data;
+                        if (read_count == 3) begin
+                            xf_valid[xf_fidx] <= 1;
+                            xf_tag[xf_fidx]   <= xf_ftag;
+                        end
+                        if (read_count == PSRAM_BEATS - 1)
+                            state <= 0;
+                    end
+                end
+                15: begin
+                    /* span list: read the next 4 entries, dropping the rest
+                     * of a longer burst */
+                    cmd_en_i <= 0;
+                    if (rd_data_valid) begin
+                        read_count <= read_count + 1'b1;
+                        if (read_count < 4)
+                            spl_buf[64*read_count[1:0]+:64] <= rd_data;
+                        if (read_count == 3) begin
+                            spl_full <= 1;
+                            spl_i    <= 0;
+                        end
+                        if (read_count == PSRAM_BEATS - 1)
+                            state <= 0;
+                    end
+                end
+                4: begin
+                    /* transform blit: write the gathered block, then on to the
+                     * next line of the band column, the next column or band */
+                    cmd_en_i <= 0;
+                    cycle    <= cycle + 1'b1;
+                    case (cycle)
+                        0, 1, 2: begin
+                            wrdata_i    <= xf_blk[64*cycle+64+:64];
+                            data_mask_i <= ln_pixelmask32[8*cycle+8+:8];
+                        end
+                        default:
+                            data_mask_i <= 8'hff;
+                        PSRAM_TCMD - 1: begin
                             cycle <= 0;
                             state <= 0;
-                            if (curr_x < (x1_val & 16'b1111_1111_1111_0000))
-                                curr_x <= curr_x + 16'd16;
+                            xf_p  <= 0;
+                            if (curr_y != xf_band_y1) begin
+                                curr_y          <= curr_y + 1'b1;
+                                curr_y_lineaddr <= curr_y_lineaddr + dst_stride;
+                                xf_lu           <= xf_lu + xf_dudy;
+                                xf_lv           <= xf_lv + xf_dvdy;
+                                xf_pu           <= xf_lu + xf_dudy;
+                                xf_pv           <= xf_lv + xf_dvdy;
+                            end else if (!gpu_lastblk) begin
+                                curr_x          <= {curr_x[15:4], 4'b0} + 16'd16;
+                                curr_y          <= xf_band_y0;
+                                curr_y_lineaddr <= xf_band_lineaddr;
+                                xf_cu           <= xf_cu + (xf_dudx << 4);
+                                xf_cv           <= xf_cv + (xf_dvdx << 4);
+                                xf_lu           <= xf_cu + (xf_dudx << 4);
+                                xf_lv           <= xf_cv + (xf_dvdx << 4);
+                                xf_pu           <= xf_cu + (xf_dudx << 4);
+                                xf_pv           <= xf_cv + (xf_dvdx << 4);
+                            end else if (xf_band_y1 == y1_val)
+                                gpu_xf_cont <= 0;
                             else begin
-                                curr_x <= x0_val;
-                                curr_y <= curr_y + 1'b1;
+                                curr_x           <= x0_val;
+                                curr_y           <= curr_y + 1'b1;
+                                curr_y_lineaddr  <= curr_y_lineaddr + dst_stride;
+                                xf_band_y0       <= curr_y + 1'b1;
+                                xf_band_lineaddr <= curr_y_lineaddr + dst_stride;
+                                xf_bu            <= xf_bu + (xf_dudy << 4);
+                                xf_bv            <= xf_bv + (xf_dvdy << 4);
+                                xf_cu            <= xf_bu + (xf_dudy << 4);
+                                xf_cv            <= xf_bv + (xf_dvdy << 4);
+                                xf_lu            <= xf_bu + (xf_dudy << 4);
+                                xf_lv            <= xf_bv + (xf_dvdy << 4);
+                                xf_pu            <= xf_bu + (xf_dudy << 4);
+                                xf_pv            <= xf_bv + (xf_dvdy << 4);
                             end
                         end
                     endcase
                 end
+                11: begin
+                    /* shaded trapezoid span: one block, masked like a blit */
+                    cmd_en_i <= 0;
+                    cycle    <= cycle + 1'b1;
+                    case (cycle)
+                        0, 1, 2: begin
+                            wrdata_i    <= shd_wdata;
+                            data_mask_i <= ln_pixelmask32[8*cycle+8+:8];
+                            shd_r       <= shd_r + (trap_drx <<< 2);
+                            shd_g       <= shd_g + (trap_dgx <<< 2);
+                            shd_b       <= shd_b + (trap_dbx <<< 2);
+                        end
+                        default:
+                            data_mask_i <= 8'hff;
+                        PSRAM_TCMD - 1: begin
+                            cycle <= 0;
+                            state <= 0;
+                            if (!gpu_lastblk)
+                                curr_x <= curr_x + gpu_blkpix;
+                            else
+                                trap_step <= 1;
+                        end
+                    endcase
+                end
             endcase
+            /* merge the queue head into the pending block */
+            if (plot_pop && plot_hvalid) begin
+                if (!plot_acc) begin
+                    plot_acc      <= 1;
+                    plot_y        <= plot_hy;
+                    plot_lineaddr <= work_addr + plot_hy * dst_stride;
+                    plot_blk   <= plot_hbyte[10:5];
+                    plot_bytes <= plot_hbytes;
+                end else
+                    plot_bytes <= plot_bytes | plot_hbytes;
+                for (pb = 0; pb < 32; pb = pb + 1)
+                    if (plot_hbytes[pb]) plot_data[8*pb+:8] <= plot_pix16[8*(pb%2)+:8];
+            end
+            /* held until the idle state takes it, the edge itself is one
+             * cycle and may come during a longer access */
+            if (vdma_start_sr[2:1] == 2'b01) begin
+                vdma_newline <= 1;
+                if ((vdma_pend || ovl_pend) && vdma_late_cnt != 16'hFFFF)
+                    vdma_late_cnt <= vdma_late_cnt + 1'b1;
+            end
+            /* cycles the pending CPU access has waited for the bus */
+            if (!mem_s_valid || state == 4'd1 || state == 4'd2 || completed)
+                arb_cpu_wait <= 0;
+            else if (arb_cpu_wait != 16'hFFFF)
+                arb_cpu_wait <= arb_cpu_wait + 1'b1;
+            arb_clr_sr <= {arb_clr_sr[1:0], arb_clr};
+            if (arb_clr_sr[2] != arb_clr_sr[1]) begin
+                arb_cpu_waitmax <= 0;
+                arb_cpu_forced  <= 0;
+                arb_vdma_urgent <= 0;
+            end
         end
     end
 
-    Gowin_DPB_256x64_1024x16 linebuf_256x64 (
-        .clka  (mclk_out),  //input clka
-        .reseta(~resetn),   //input reseta
-
-        .cea(1'b1),  //input cea
-        .wrea(vdma_wstrb),  //input wrea
-        .ocea(1'b0),  //input ocea
-        .ada(vdma_waddr),  //input [7:0] ada
-        .dina(vdma_wdata),  //input [63:0] dina
-
-        /* Read-only Port B for line pixels */
-        .clkb(pclk),  //input clkb
-        .resetb(~resetn),  //input resetb
-        .ceb(1'b1),  //input ceb
-        .wreb(1'b0),  //input wreb
-        .oceb(1'b0),  //input oceb
-        .adb(dma_raddr[9:0]),  //input [9:0] adb
-        .dinb(16'b0),
-        .doutb(dout_o)  //output [15:0] doutb
+    /* scanout depth and scale change in the vertical blank, like the overlay */
+    always @(posedge pclk)
+        if (CounterX == 0 && CounterY == LCD_HEIGHT + 1'b1) begin
+            scan_bpp_l   <= fb_mode[1:0];
+            scan_scale_l <= fb_mode[5:4];
+        end
+
+    FB_Palette palette (
+        .pclk(pclk),
+        .scan_bpp(scan_bpp_l),
+        .lane_i(src_x[1:0]),
+        .word_i(dout_o),
+
+        .pal_clk(clk),
+        .pal_we(pal_we),
+        .pal_waddr(pal_waddr),
+        .pal_wdata(pal_wdata),
+
+        .pix_o(base_pix_o)
+    );
+
+    FB_Overlay #(
+        .H_MAX(H_MAX),
+        .V_LATCH(LCD_HEIGHT + 1'b1)
+    ) overlay (
+        .pclk(pclk),
+        .counter_x(CounterX),
+        .counter_y(CounterY),
+
+        .lb_clk(mclk_out),
+        .lb_we(ovl_wstrb),
+        .lb_waddr(vdma_waddr),
+        .lb_wdata(vdma_wdata),
+
+        .ovl_addr(ovl_addr),
+        .ovl_ctrl(ovl_ctrl),
+        .ovl_x0y0(ovl_x0y0),
+        .ovl_x1y1(ovl_x1y1),
+        .ovl_on_l(ovl_on_l),
+        .ovl_addr_l(ovl_addr_l),
+        .ovl_x0_l(ovl_x0_l),
+        .ovl_x1_l(ovl_x1_l),
+        .ovl_y0_l(ovl_y0_l),
+        .ovl_y1_l(ovl_y1_l),
+
+        .pix_i(base_pix_o),
+        .pix_o(ovl_pix_o)
+    );
+
+    FB_LineBuf linebuf (
+        .wclk(mclk_out),
+        .we(vdma_wstrb),
+        .waddr(vdma_waddr),
+        .wdata(vdma_wdata),
+
+        /* read-only port for line pixels */
+        .rclk(pclk),
+        .rbank(scan_srcline[0]),
+        .raddr(dma_raddr[9:0]),
+        .rdata(dout_o)
     );
 
 endmodule /* PSRAM_FRAMEBUFFER_LCD */
 
-module FB_Registers (
+module FB_Registers #(
+    parameter [15:0] LCD_WIDTH = 16'd1024,
+    parameter [15:0] LCD_HEIGHT = 16'd600,
+    parameter [7:0] PSRAM_BURST = 8'd16
+) (
     input cpu_clk,
     input resetn,
 
@@ -581,8 +1946,74 @@ module FB_Registers (
     output [31:0] x0y0_point,
     output [31:0] x1y1_point,
     output [15:0] rgb565,
+    output [7:0] color_idx,
+    output [7:0] color_alpha,
+    output [22:0] src_addr,
+    output [31:0] srcxy_point,
+    output [31:0] txt_ctrl,
+    output [31:0] txt_cursor,
+    output [31:0] txt_scroll,
+    output [255:0] txt_palette,
+    output txt_we,
+    output [12:0] txt_waddr,
+    output [15:0] txt_wdata,
+    output [31:0] spr_enable,
+    output [31:0] spr_key,
+    output [127:0] spr_pos,
+    output spr_we,
+    output [11:0] spr_waddr,
+    output [15:0] spr_wdata,
+    output [22:0] ovl_addr,
+    output [31:0] ovl_ctrl,
+    output [31:0] ovl_x0y0,
+    output [31:0] ovl_x1y1,
+    output [31:0] fb_mode,
+    output pal_we,
+    output [7:0] pal_waddr,
+    output [15:0] pal_wdata,
+    output [31:0] arb_ctrl,
+    output arb_clr,
+    input [31:0] arb_cpu_i,
+    input [31:0] arb_vdma_i,
+    input [31:0] vdma_stat_i,
+    input [31:0] vdma_frames_i,
+    output plot_we,
+    output [31:0] plot_wdata,
+    input plot_full_i,
+    input [31:0] plot_bursts_i,
+    output [31:0] clip_x0y0,
+    output [31:0] clip_x1y1,
+    output [31:0] target_size,
+    output [31:0] gpu_stride,
+    output [287:0] trap_params,
+    output [223:0] grad_params,
+    output [223:0] xf_params,
+    output [63:0] span_params,
     input busy_i
 );
+    /* read-only feature bits, see GPU_CAP_* in appmon hwdefs.h */
+    localparam GPU_CAP_BLIT = 32'h0000_0001;
+    localparam GPU_CAP_TEXT = 32'h0000_0002;
+    localparam GPU_CAP_SPRITES = 32'h0000_0004;
+    localparam GPU_CAP_OVERLAY = 32'h0000_0008;
+    localparam GPU_CAP_INDEXED = 32'h0000_0010;
+    localparam GPU_CAP_SCALED = 32'h0000_0020;
+    localparam GPU_CAP_ARB = 32'h0000_0040;
+    localparam GPU_CAP_VSTAT = 32'h0000_0080;
+    /* [15:8] is the PSRAM burst length */
+    localparam GPU_CAP_PLOT = 32'h0001_0000;
+    localparam GPU_CAP_CLIP = 32'h0002_0000;
+    localparam GPU_CAP_SURFACE = 32'h0004_0000;
+    localparam GPU_CAP_TRAP = 32'h0008_0000;
+    localparam GPU_CAP_BLEND = 32'h0010_0000;
+    localparam GPU_CAP_GRAD = 32'h0020_0000;
+    localparam GPU_CAP_XFORM = 32'h0040_0000;
+    localparam GPU_CAP_SPANS = 32'h0080_0000;
+    localparam GPU_CAPS = GPU_CAP_BLIT | GPU_CAP_TEXT | GPU_CAP_SPRITES | GPU_CAP_OVERLAY |
+                          GPU_CAP_INDEXED | GPU_CAP_SCALED | GPU_CAP_ARB | GPU_CAP_VSTAT |
+                          GPU_CAP_PLOT | GPU_CAP_CLIP | GPU_CAP_SURFACE | GPU_CAP_TRAP |
+                          GPU_CAP_BLEND | GPU_CAP_GRAD | GPU_CAP_XFORM | GPU_CAP_SPANS;
+
     reg [31:0] ctrl_stat_reg;
     reg [31:0] disp_addr_reg;
     reg [31:0] work_addr_reg;
@@ -590,6 +2021,45 @@ module FB_Registers (
     reg [31:0] x0y0_reg;
     reg [31:0] x1y1_reg;
     reg [31:0] size_reg;
+    reg [31:0] src_addr_reg;
+    reg [31:0] srcxy_reg;
+    reg [31:0] txt_ctrl_reg;
+    reg [31:0] txt_cursor_reg;
+    reg [31:0] txt_scroll_reg;
+    reg [15:0] txt_pal[0:15];
+    reg [3:0] txt_palidx;
+    reg txt_we_r;
+    reg [12:0] txt_waddr_r;
+    reg [15:0] txt_wdata_r;
+    reg [31:0] spr_enable_reg;
+    reg [31:0] spr_key_reg;
+    reg [31:0] spr_pos_reg[0:3];
+    reg spr_we_r;
+    reg [11:0] spr_waddr_r;
+    reg [15:0] spr_wdata_r;
+    reg [31:0] ovl_addr_reg;
+    reg [31:0] ovl_ctrl_reg;
+    reg [31:0] ovl_x0y0_reg;
+    reg [31:0] ovl_x1y1_reg;
+    reg [31:0] fb_mode_reg;
+    reg [31:0] pal_reg;
+    reg pal_we_r;
+    reg [31:0] arb_ctrl_reg;
+    reg arb_clr_r;
+    reg plot_we_r;
+    reg [31:0] plot_wdata_r;
+    reg [31:0] clip_x0y0_reg;
+    reg [31:0] clip_x1y1_reg;
+    reg [31:0] stride_reg;
+    reg [31:0] trap_reg[0:8];
+    wire [5:0] trap_idx = mem_addr[7:2] - 6'd36;
+    reg [31:0] grad_reg[0:6];
+    wire [5:0] grad_idx = mem_addr[7:2] - 6'd45;
+    reg [31:0] xf_reg[0:6];
+    wire [5:0] xf_idx = mem_addr[7:2] - 6'd52;
+    reg [31:0] span_reg[0:1];
+    wire [5:0] span_idx = mem_addr[7:2] - 6'd59;
+    integer ti;
     reg [31:0] rdata_r;
     reg ready_r;
 
@@ -598,6 +2068,55 @@ module FB_Registers (
     assign work_addr  = work_addr_reg[22:0];
     assign x0y0_point = x0y0_reg;
     assign x1y1_point = x1y1_reg;
+    assign src_addr   = src_addr_reg[22:0];
+    assign srcxy_point = srcxy_reg;
+    assign txt_ctrl   = txt_ctrl_reg;
+    assign txt_cursor = txt_cursor_reg;
+    assign txt_scroll = txt_scroll_reg;
+    assign txt_we     = txt_we_r;
+    assign txt_waddr  = txt_waddr_r;
+    assign txt_wdata  = txt_wdata_r;
+    assign spr_enable = spr_enable_reg;
+    assign spr_key    = spr_key_reg;
+    assign spr_pos    = {spr_pos_reg[3], spr_pos_reg[2], spr_pos_reg[1], spr_pos_reg[0]};
+    assign spr_we     = spr_we_r;
+    assign spr_waddr  = spr_waddr_r;
+    assign spr_wdata  = spr_wdata_r;
+    assign ovl_addr   = ovl_addr_reg[22:0];
+    assign ovl_ctrl   = ovl_ctrl_reg;
+    assign ovl_x0y0   = ovl_x0y0_reg;
+    assign ovl_x1y1   = ovl_x1y1_reg;
+    assign fb_mode    = fb_mode_reg;
+    assign pal_we     = pal_we_r;
+    assign pal_waddr  = pal_reg[23:16];
+    assign pal_wdata  = pal_reg[15:0];
+    assign color_idx  = color_reg[7:0];
+    assign color_alpha = color_reg[31:24];
+    assign arb_ctrl   = arb_ctrl_reg;
+    assign arb_clr    = arb_clr_r;
+    assign plot_we    = plot_we_r;
+    assign plot_wdata = plot_wdata_r;
+    assign clip_x0y0  = clip_x0y0_reg;
+    assign clip_x1y1  = clip_x1y1_reg;
+    assign target_size = size_reg;
+    assign gpu_stride = stride_reg;
+
+    genvar pi;
+    generate
+        for (pi = 0; pi < 16; pi = pi + 1) begin : gen_txt_palette
+            assign txt_palette[pi*16+:16] = txt_pal[pi];
+        end
+        for (pi = 0; pi < 9; pi = pi + 1) begin : gen_trap_params
+            assign trap_params[pi*32+:32] = trap_reg[pi];
+        end
+        for (pi = 0; pi < 7; pi = pi + 1) begin : gen_grad_params
+            assign grad_params[pi*32+:32] = grad_reg[pi];
+            assign xf_params[pi*32+:32] = xf_reg[pi];
+        end
+        for (pi = 0; pi < 2; pi = pi + 1) begin : gen_span_params
+            assign span_params[pi*32+:32] = span_reg[pi];
+        end
+    endgenerate
 
     wire r0, g0, b0;
     assign r0     = color_reg[19] | color_reg[18] | color_reg[17] | color_reg[16];
@@ -615,60 +2134,339 @@ module FB_Registers (
             x0y0_reg      <= 32'b0;
             x1y1_reg      <= 32'b0;
             size_reg      <= 32'b0;
+            src_addr_reg  <= 32'b0;
+            srcxy_reg     <= 32'b0;
+            txt_ctrl_reg  <= 32'b0;
+            txt_cursor_reg <= 32'b0;
+            txt_scroll_reg <= 32'b0;
+            txt_palidx    <= 4'd0;
+            txt_we_r      <= 1'b0;
+            spr_enable_reg <= 32'b0;
+            spr_key_reg   <= 32'b0;
+            spr_pos_reg[0] <= 32'b0;
+            spr_pos_reg[1] <= 32'b0;
+            spr_pos_reg[2] <= 32'b0;
+            spr_pos_reg[3] <= 32'b0;
+            spr_we_r      <= 1'b0;
+            ovl_addr_reg  <= 32'b0;
+            ovl_ctrl_reg  <= 32'h0000_FF00;  /* off, opaque */
+            ovl_x0y0_reg  <= 32'b0;
+            ovl_x1y1_reg  <= 32'b0;
+            fb_mode_reg   <= 32'b0;
+            pal_reg       <= 32'b0;
+            pal_we_r      <= 1'b0;
+            arb_ctrl_reg  <= 32'h0080_0040;  /* 128 px slack, 64 cycles */
+            arb_clr_r     <= 1'b0;
+            plot_we_r     <= 1'b0;
+            clip_x0y0_reg <= 32'b0;  /* the whole screen */
+            clip_x1y1_reg <= {LCD_HEIGHT - 1'b1, LCD_WIDTH - 1'b1};
+            stride_reg    <= 32'b0;
+            for (ti = 0; ti < 9; ti = ti + 1)
+                trap_reg[ti] <= 32'b0;
+            for (ti = 0; ti < 7; ti = ti + 1)
+                grad_reg[ti] <= 32'b0;
+            for (ti = 0; ti < 7; ti = ti + 1)
+                xf_reg[ti] <= 32'b0;
+            for (ti = 0; ti < 2; ti = ti + 1)
+                span_reg[ti] <= 32'b0;
+            /* VGA text mode colors in RGB565 */
+            txt_pal[0]  <= 16'h0000; txt_pal[1]  <= 16'hA800;
+            txt_pal[2]  <= 16'h0540; txt_pal[3]  <= 16'hAAA0;
+            txt_pal[4]  <= 16'h0015; txt_pal[5]  <= 16'hA815;
+            txt_pal[6]  <= 16'h0555; txt_pal[7]  <= 16'hAD55;
+            txt_pal[8]  <= 16'h52AA; txt_pal[9]  <= 16'hFAAA;
+            txt_pal[10] <= 16'h57EA; txt_pal[11] <= 16'hFFEA;
+            txt_pal[12] <= 16'h52BF; txt_pal[13] <= 16'hFABF;
+            txt_pal[14] <= 16'h57FF; txt_pal[15] <= 16'hFFFF;
         end else begin
-            ready_r <= 1'b0;
-            if (mem_valid && !ready_r) begin
+            ready_r  <= 1'b0;
+            txt_we_r <= 1'b0;
+            spr_we_r <= 1'b0;
+            pal_we_r <= 1'b0;
+            plot_we_r <= 1'b0;
+            if (mem_valid && !ready_r && mem_addr[16]) begin
+                /* sprite pixels, one RGB565 pixel per word, write-only */
+                ready_r     <= 1'b1;
+                spr_we_r    <= |mem_wstrb;
+                spr_waddr_r <= mem_addr[13:2];
+                spr_wdata_r <= mem_wdata[15:0];
+                rdata_r     <= 32'h0;
+            end else if (mem_valid && !ready_r && mem_addr[15]) begin
+                /* text layer cells, one word per cell, write-only */
+                ready_r     <= 1'b1;
+                txt_we_r    <= |mem_wstrb;
+                txt_waddr_r <= mem_addr[14:2];
+                txt_wdata_r <= mem_wdata[15:0];
+                rdata_r     <= 32'h0;
+            end else if (mem_valid && !ready_r && mem_addr[7:2] == 6'd32 && |mem_wstrb) begin
+                /* plot port, the store waits while the queue is full */
+                if (!plot_full_i) begin
+                    ready_r      <= 1'b1;
+                    plot_we_r    <= 1'b1;
+                    plot_wdata_r <= mem_wdata;
+                end
+            end else if (mem_valid && !ready_r) begin
                 ready_r <= 1'b1;
-                case (mem_addr[4:2])
-                    3'd0: begin
+                case (mem_addr[7:2])
+                    6'd0: begin
                         if (mem_wstrb[3]) ctrl_stat_reg[31:24] <= mem_wdata[31:24];
                         if (mem_wstrb[2]) ctrl_stat_reg[24:16] <= mem_wdata[24:16];
                         if (mem_wstrb[1]) ctrl_stat_reg[15:8] <= mem_wdata[15:8];
                         if (mem_wstrb[0]) ctrl_stat_reg[7:0] <= mem_wdata[7:0];
                         rdata_r <= {ctrl_stat_reg[31:1], busy_i};
                     end
-                    3'd1: begin
+                    6'd1: begin
                         if (mem_wstrb[3]) disp_addr_reg[31:24] <= mem_wdata[31:24];
                         if (mem_wstrb[2]) disp_addr_reg[24:16] <= mem_wdata[24:16];
                         if (mem_wstrb[1]) disp_addr_reg[15:8] <= mem_wdata[15:8];
                         if (mem_wstrb[0]) disp_addr_reg[7:0] <= mem_wdata[7:0];
                         rdata_r <= disp_addr_reg;
                     end
-                    3'd2: begin
+                    6'd2: begin
                         if (mem_wstrb[3]) work_addr_reg[31:24] <= mem_wdata[31:24];
                         if (mem_wstrb[2]) work_addr_reg[24:16] <= mem_wdata[24:16];
                         if (mem_wstrb[1]) work_addr_reg[15:8] <= mem_wdata[15:8];
                         if (mem_wstrb[0]) work_addr_reg[7:0] <= mem_wdata[7:0];
                         rdata_r <= work_addr_reg;
                     end
-                    3'd3: begin
+                    6'd3: begin
                         if (mem_wstrb[3]) color_reg[31:24] <= mem_wdata[31:24];
                         if (mem_wstrb[2]) color_reg[24:16] <= mem_wdata[24:16];
                         if (mem_wstrb[1]) color_reg[15:8] <= mem_wdata[15:8];
                         if (mem_wstrb[0]) color_reg[7:0] <= mem_wdata[7:0];
                         rdata_r <= color_reg;
                     end
-                    3'd4: begin
+                    6'd4: begin
                         if (mem_wstrb[3]) x0y0_reg[31:24] <= mem_wdata[31:24];
                         if (mem_wstrb[2]) x0y0_reg[24:16] <= mem_wdata[24:16];
                         if (mem_wstrb[1]) x0y0_reg[15:8] <= mem_wdata[15:8];
                         if (mem_wstrb[0]) x0y0_reg[7:0] <= mem_wdata[7:0];
                         rdata_r <= x0y0_reg;
                     end
-                    3'd5: begin
+                    6'd5: begin
                         if (mem_wstrb[3]) x1y1_reg[31:24] <= mem_wdata[31:24];
                         if (mem_wstrb[2]) x1y1_reg[24:16] <= mem_wdata[24:16];
                         if (mem_wstrb[1]) x1y1_reg[15:8] <= mem_wdata[15:8];
                         if (mem_wstrb[0]) x1y1_reg[7:0] <= mem_wdata[7:0];
                         rdata_r <= x1y1_reg;
                     end
-                    3'd6: begin
+                    6'd6: begin
+                        /* render target {height[31:16], width[15:0]}, 0 the screen */
                         if (mem_wstrb[3]) size_reg[31:24] <= mem_wdata[31:24];
                         if (mem_wstrb[2]) size_reg[24:16] <= mem_wdata[24:16];
                         if (mem_wstrb[1]) size_reg[15:8] <= mem_wdata[15:8];
                         if (mem_wstrb[0]) size_reg[7:0] <= mem_wdata[7:0];
                         rdata_r <= size_reg;
                     end
+                    6'd7: begin
+                        // read-only register, PSRAM burst length in [15:8]
+                        rdata_r <= GPU_CAPS | {PSRAM_BURST, 8'h00};
+                    end
+                    6'd8: begin
+                        if (mem_wstrb[3]) src_addr_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) src_addr_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) src_addr_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) src_addr_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= src_addr_reg;
+                    end
+                    6'd9: begin
+                        if (mem_wstrb[3]) srcxy_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) srcxy_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) srcxy_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) srcxy_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= srcxy_reg;
+                    end
+                    6'd10: begin
+                        if (mem_wstrb[3]) txt_ctrl_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) txt_ctrl_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) txt_ctrl_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) txt_ctrl_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= txt_ctrl_reg;
+                    end
+                    6'd11: begin
+                        if (mem_wstrb[3]) txt_cursor_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) txt_cursor_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) txt_cursor_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) txt_cursor_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= txt_cursor_reg;
+                    end
+                    6'd12: begin
+                        if (mem_wstrb[3]) txt_scroll_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) txt_scroll_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) txt_scroll_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) txt_scroll_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= txt_scroll_reg;
+                    end
+                    6'd13: begin
+                        /* palette entry {index[19:16], rgb565[15:0]} */
+                        if (mem_wstrb[2]) txt_palidx <= mem_wdata[19:16];
+                        if (mem_wstrb[2] && mem_wstrb[1] && mem_wstrb[0])
+                            txt_pal[mem_wdata[19:16]] <= mem_wdata[15:0];
+                        rdata_r <= {12'b0, txt_palidx, txt_pal[txt_palidx]};
+                    end
+                    6'd14: begin
+                        if (mem_wstrb[3]) spr_enable_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) spr_enable_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) spr_enable_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) spr_enable_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= spr_enable_reg;
+                    end
+                    6'd15: begin
+                        if (mem_wstrb[3]) spr_key_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) spr_key_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) spr_key_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) spr_key_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= spr_key_reg;
+                    end
+                    6'd16, 6'd17, 6'd18, 6'd19: begin
+                        /* sprite position {y[27:16], x[11:0]}, signed */
+                        if (mem_wstrb[3]) spr_pos_reg[mem_addr[3:2]][31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) spr_pos_reg[mem_addr[3:2]][23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) spr_pos_reg[mem_addr[3:2]][15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) spr_pos_reg[mem_addr[3:2]][7:0] <= mem_wdata[7:0];
+                        rdata_r <= spr_pos_reg[mem_addr[3:2]];
+                    end
+                    6'd20: begin
+                        if (mem_wstrb[3]) ovl_addr_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) ovl_addr_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) ovl_addr_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) ovl_addr_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= ovl_addr_reg;
+                    end
+                    6'd21: begin
+                        /* {key rgb565[31:16], alpha[15:8], key enable[1], enable[0]} */
+                        if (mem_wstrb[3]) ovl_ctrl_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) ovl_ctrl_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) ovl_ctrl_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) ovl_ctrl_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= ovl_ctrl_reg;
+                    end
+                    6'd22: begin
+                        if (mem_wstrb[3]) ovl_x0y0_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) ovl_x0y0_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) ovl_x0y0_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) ovl_x0y0_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= ovl_x0y0_reg;
+                    end
+                    6'd23: begin
+                        if (mem_wstrb[3]) ovl_x1y1_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) ovl_x1y1_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) ovl_x1y1_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) ovl_x1y1_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= ovl_x1y1_reg;
+                    end
+                    6'd24: begin
+                        /* {draw bpp[9:8], scale[5:4], scanout bpp[1:0]}
+                         * bpp 0: 16, 1: 8, 2: 4, scale 0: 1x, 1: 2x, 2: 4x */
+                        if (mem_wstrb[3]) fb_mode_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) fb_mode_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) fb_mode_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) fb_mode_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= fb_mode_reg;
+                    end
+                    6'd25: begin
+                        /* palette entry {index[23:16], rgb565[15:0]}, write-only RAM */
+                        if (mem_wstrb[2] && mem_wstrb[1] && mem_wstrb[0]) begin
+                            pal_reg  <= mem_wdata;
+                            pal_we_r <= 1'b1;
+                        end
+                        rdata_r <= pal_reg;
+                    end
+                    6'd26: begin
+                        // read-only register, {height, width} at the selected scale
+                        rdata_r <= {LCD_HEIGHT >> fb_mode_reg[5:4], LCD_WIDTH >> fb_mode_reg[5:4]};
+                    end
+                    6'd27: begin
+                        /* {VDMA slack in pixels[26:16], max CPU wait in mclk cycles[15:0]}
+                         * slack 0: video blocks go first as soon as due, wait 0: no bound */
+                        if (mem_wstrb[3]) arb_ctrl_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) arb_ctrl_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) arb_ctrl_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) arb_ctrl_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= arb_ctrl_reg;
+                    end
+                    6'd28, 6'd29: begin
+                        /* arbiter counters, a write to either clears all:
+                         * 28 {forced CPU grants[31:16], longest CPU wait[15:0]}
+                         * 29 video blocks fetched urgently */
+                        if (|mem_wstrb) arb_clr_r <= ~arb_clr_r;
+                        rdata_r <= mem_addr[2] ? arb_vdma_i : arb_cpu_i;
+                    end
+                    6'd30: begin
+                        // read-only, last frame {underrun blocks[31:16], late lines[15:0]}
+                        rdata_r <= vdma_stat_i;
+                    end
+                    6'd31: begin
+                        // read-only, frames scanned out since reset
+                        rdata_r <= vdma_frames_i;
+                    end
+                    6'd32: begin
+                        // plot port, a read gives the blocks written since reset
+                        rdata_r <= plot_bursts_i;
+                    end
+                    6'd33: begin
+                        /* scissor top left {y[31:16], x[15:0]}, signed */
+                        if (mem_wstrb[3]) clip_x0y0_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) clip_x0y0_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) clip_x0y0_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) clip_x0y0_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= clip_x0y0_reg;
+                    end
+                    6'd34: begin
+                        /* scissor bottom right, inclusive */
+                        if (mem_wstrb[3]) clip_x1y1_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) clip_x1y1_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) clip_x1y1_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) clip_x1y1_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= clip_x1y1_reg;
+                    end
+                    6'd35: begin
+                        /* line strides in bytes {source[31:16], target[15:0]}, 0 is 2048 */
+                        if (mem_wstrb[3]) stride_reg[31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) stride_reg[23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) stride_reg[15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) stride_reg[7:0] <= mem_wdata[7:0];
+                        rdata_r <= stride_reg;
+                    end
+                    6'd36, 6'd37, 6'd38, 6'd39, 6'd40, 6'd41, 6'd42, 6'd43, 6'd44: begin
+                        /* trapezoid: 36..39 edges {xl, dxl, xr, dxr} in 16.16,
+                         * 40..42 {d/dx, at the left edge} of R, G, B in 8.8,
+                         * 43 {dG, dR} and 44 dB per line along the left edge */
+                        if (mem_wstrb[3]) trap_reg[trap_idx][31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) trap_reg[trap_idx][23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) trap_reg[trap_idx][15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) trap_reg[trap_idx][7:0] <= mem_wdata[7:0];
+                        rdata_r <= trap_reg[trap_idx];
+                    end
+                    6'd45, 6'd46, 6'd47, 6'd48, 6'd49, 6'd50, 6'd51: begin
+                        /* gradient: 45, 46 RGB888 at t = 0, 1; t(x, y) = 47 +
+                         * 48 * x + 49 * y + 50 * (x * x + y * y) with 47 in
+                         * 20.12, 48, 49 in 8.24, 50 in 4.28; 51 {dither, radial} */
+                        if (mem_wstrb[3]) grad_reg[grad_idx][31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) grad_reg[grad_idx][23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) grad_reg[grad_idx][15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) grad_reg[grad_idx][7:0] <= mem_wdata[7:0];
+                        rdata_r <= grad_reg[grad_idx];
+                    end
+                    6'd52, 6'd53, 6'd54, 6'd55, 6'd56, 6'd57, 6'd58: begin
+                        /* transform blit: 52, 53 source u, v of target pixel
+                         * 0, 0, 54..57 du/dx, dv/dx, du/dy, dv/dy, all 16.16,
+                         * 58 {vmax, umax} of the source */
+                        if (mem_wstrb[3]) xf_reg[xf_idx][31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) xf_reg[xf_idx][23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) xf_reg[xf_idx][15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) xf_reg[xf_idx][7:0] <= mem_wdata[7:0];
+                        rdata_r <= xf_reg[xf_idx];
+                    end
+                    6'd59, 6'd60: begin
+                        /* span list: 59 its PSRAM address, 32-byte aligned,
+                         * 60 {colors[31], count[15:0]} */
+                        if (mem_wstrb[3]) span_reg[span_idx][31:24] <= mem_wdata[31:24];
+                        if (mem_wstrb[2]) span_reg[span_idx][23:16] <= mem_wdata[23:16];
+                        if (mem_wstrb[1]) span_reg[span_idx][15:8] <= mem_wdata[15:8];
+                        if (mem_wstrb[0]) span_reg[span_idx][7:0] <= mem_wdata[7:0];
+                        rdata_r <= span_reg[span_idx];
+                    end
                     default: rdata_r <= 32'h0;
                 endcase
             end
@@ -679,3 +2477,462 @@ module FB_Registers (
     assign mem_rdata = rdata_r;
 
 endmodule /* FB_Registers */
+
+/* Plot port queue from the CPU clock to mclk, 16 points deep. The
+ * pointers cross in gray code through two flops, so full and empty are
+ * only ever late, never wrong. The head is read combinationally. */
+module FB_PlotFifo (
+    input wclk,
+    input resetn,
+    input we,
+    input [31:0] wdata,
+    output full,
+
+    input rclk,
+    input re,
+    output [31:0] rdata,
+    output empty
+);
+    reg [31:0] mem[0:15];
+    reg [4:0] wbin, wgray, rgray_w1, rgray_w2;
+    reg [4:0] rbin, rgray, wgray_r1, wgray_r2;
+    wire [4:0] wbin_next = wbin + 1'b1;
+    wire [4:0] rbin_next = rbin + 1'b1;
+
+    assign full  = (wgray == {~rgray_w2[4:3], rgray_w2[2:0]});
+    assign empty = (rgray == wgray_r2);
+    assign rdata = mem[rbin[3:0]];
+
+    always @(posedge wclk)
+        if (we && !full) mem[wbin[3:0]] <= wdata;
+
+    always @(posedge wclk) begin
+        if (!resetn) begin
+            wbin     <= 0;
+            wgray    <= 0;
+            rgray_w1 <= 0;
+            rgray_w2 <= 0;
+        end else begin
+            rgray_w1 <= rgray;
+            rgray_w2 <= rgray_w1;
+            if (we && !full) begin
+                wbin  <= wbin_next;
+                wgray <= wbin_next ^ (wbin_next >> 1);
+            end
+        end
+    end
+
+    always @(posedge rclk) begin
+        if (!resetn) begin
+            rbin     <= 0;
+            rgray    <= 0;
+            wgray_r1 <= 0;
+            wgray_r2 <= 0;
+        end else begin
+            wgray_r1 <= wgray;
+            wgray_r2 <= wgray_r1;
+            if (re && !empty) begin
+                rbin  <= rbin_next;
+                rgray <= rbin_next ^ (rbin_next >> 1);
+            end
+        end
+    end
+
+endmodule /* FB_PlotFifo */
+
+/* Base scanout linebuffer, two halves of 256 64-bit words (one 1024
+ * pixel line at 16bpp each): the VDMA writes one half while the other is
+ * shown. Read like a 1024x16 port with one pclk of latency. Inferred as 2
+ * BSRAM blocks (the 256x64 DPB IP it replaces took 4). */
+module FB_LineBuf (
+    input wclk,
+    input we,
+    input [8:0] waddr,
+    input [63:0] wdata,
+
+    input rclk,
+    input rbank,
+    input [9:0] raddr,
+    output [15:0] rdata
+);
+    reg [63:0] mem[0:511];
+
+    always @(posedge wclk)
+        if (we) mem[waddr] <= wdata;
+
+    reg [63:0] q;
+    reg [1:0] lane;
+    always @(posedge rclk) begin
+        q    <= mem[{rbank, raddr[9:2]}];
+        lane <= raddr[1:0];
+    end
+
+    wire [63:0] lane_word = q >> {lane, 4'b0};
+    assign rdata = lane_word[15:0];
+
+endmodule /* FB_LineBuf */
+
+/* Source block cache of the transform blit: 32 blocks of 4 beats filled
+ * from PSRAM reads, read a 16bpp pixel at a time, one cycle latency. */
+module FB_BlockCache (
+    input clk,
+    input we,
+    input [6:0] waddr,
+    input [63:0] wdata,
+
+    input [8:0] raddr,
+    output [15:0] rdata
+);
+    reg [63:0] mem[0:127];
+
+    always @(posedge clk)
+        if (we) mem[waddr] <= wdata;
+
+    reg [63:0] q;
+    reg [1:0] lane;
+    always @(posedge clk) begin
+        q    <= mem[raddr[8:2]];
+        lane <= raddr[1:0];
+    end
+
+    wire [63:0] lane_word = q >> {lane, 4'b0};
+    assign rdata = lane_word[15:0];
+
+endmodule /* FB_BlockCache */
+
+/* Indexed scanout: picks the 8 or 4 bit pixel out of the linebuffer word
+ * and looks it up in a 256 entry RGB565 palette (one BSRAM block). At
+ * 16bpp the word is passed through with the same one cycle latency. */
+module FB_Palette (
+    input pclk,
+    input [1:0] scan_bpp,
+    input [1:0] lane_i,
+    input [15:0] word_i,
+
+    input pal_clk,
+    input pal_we,
+    input [7:0] pal_waddr,
+    input [15:0] pal_wdata,
+
+    output [15:0] pix_o
+);
+    reg [15:0] pal[0:255];
+
+    always @(posedge pal_clk)
+        if (pal_we) pal[pal_waddr] <= pal_wdata;
+
+    /* lane_i comes with the linebuffer address, word_i a cycle later */
+    reg [1:0] lane;
+    always @(posedge pclk)
+        lane <= lane_i;
+
+    wire [15:0] nibbles = word_i >> {lane, 2'b0};
+    wire [7:0] idx = (scan_bpp == 2'd1) ? (lane[0] ? word_i[15:8] : word_i[7:0]) :
+                                          {4'b0, nibbles[3:0]};
+
+    reg [15:0] pal_q, direct_q;
+    reg direct;
+    always @(posedge pclk) begin
+        pal_q    <= pal[idx];
+        direct_q <= word_i;
+        direct   <= (scan_bpp == 2'd0);
+    end
+
+    assign pix_o = direct ? direct_q : pal_q;
+
+endmodule /* FB_Palette */
+
+/* Overlay layer, composited over the base framebuffer line.
+ * Pixel (0,0) of the overlay surface at ovl_addr (2048-byte aligned, 2048
+ * bytes per line) is shown at the top left of the window x0y0..x1y1
+ * (inclusive). The VDMA fetches only the window part of each line into
+ * lb[]; on display an overlay pixel equal to the key color (if enabled)
+ * shows the base, otherwise it is blended with alpha (255 is opaque).
+ * Address, window and mode are latched in the vertical blank, so a
+ * double-buffered overlay or a moving window never tears. lb[] is
+ * ping-pong like the base linebuffer (line n in half n[0]) and inferred
+ * as 2 BSRAM blocks (64 bit wide writes from the VDMA). */
+module FB_Overlay #(
+    parameter H_MAX = 11'd1432,
+    parameter V_LATCH = 10'd601
+) (
+    input pclk,
+    input [10:0] counter_x,
+    input [9:0] counter_y,
+
+    input lb_clk,
+    input lb_we,
+    input [8:0] lb_waddr,
+    input [63:0] lb_wdata,
+
+    input [22:0] ovl_addr,
+    input [31:0] ovl_ctrl,
+    input [31:0] ovl_x0y0,
+    input [31:0] ovl_x1y1,
+    output reg ovl_on_l,
+    output reg [22:0] ovl_addr_l,
+    output reg [10:0] ovl_x0_l,
+    output reg [10:0] ovl_x1_l,
+    output reg [9:0] ovl_y0_l,
+    output reg [9:0] ovl_y1_l,
+
+    input [15:0] pix_i,
+    output reg [15:0] pix_o
+);
+    reg [63:0] lb[0:511];
+
+    always @(posedge lb_clk)
+        if (lb_we) lb[lb_waddr] <= lb_wdata;
+
+    function [15:0] blend565(input [15:0] o, input [15:0] b, input [8:0] a);
+        reg [8:0] na;
+        reg [13:0] r, g, bl;
+        begin
+            na = 9'd256 - a;
+            r  = o[15:11] * a + b[15:11] * na;
+            g  = o[10:5] * a + b[10:5] * na;
+            bl = o[4:0] * a + b[4:0] * na;
+            blend565 = {r[12:8], g[13:8], bl[12:8]};
+        end
+    endfunction
+
+    /* screen position of the pixel after the one addressed in the linebuffer */
+    reg [10:0] qx;
+    reg [9:0] sline;
+    reg key_l;
+    reg [15:0] key565_l;
+    reg [8:0] alpha_l;
+
+    always @(posedge pclk) begin
+        if (counter_x == H_MAX - 1'b1) begin
+            qx    <= 0;
+            sline <= counter_y;
+        end else
+            qx <= qx + 1'b1;
+        if (counter_x == 0 && counter_y == V_LATCH) begin
+            ovl_on_l   <= ovl_ctrl[0] && (ovl_x1y1[10:0] >= ovl_x0y0[10:0]) &&
+                          (ovl_x1y1[25:16] >= ovl_x0y0[25:16]);
+            key_l      <= ovl_ctrl[1];
+            alpha_l    <= ovl_ctrl[15:8] + ovl_ctrl[15];  /* 0..256 */
+            key565_l   <= ovl_ctrl[31:16];
+            ovl_addr_l <= ovl_addr;
+            ovl_x0_l   <= ovl_x0y0[10:0];
+            ovl_y0_l   <= ovl_x0y0[25:16];
+            ovl_x1_l   <= ovl_x1y1[10:0];
+            ovl_y1_l   <= ovl_x1y1[25:16];
+        end
+    end
+
+    wire [10:0] off = qx - ovl_x0_l;
+    wire inside = ovl_on_l && (sline >= ovl_y0_l) && (sline <= ovl_y1_l) &&
+                  (qx >= ovl_x0_l) && (qx <= ovl_x1_l);
+
+    /* stage 1: overlay word, in step with the base linebuffer output */
+    reg [63:0] word1;
+    reg [1:0] lane1;
+    reg in1;
+    always @(posedge pclk) begin
+        word1 <= lb[{sline[0], off[9:2]}];
+        lane1 <= off[1:0];
+        in1   <= inside;
+    end
+
+    wire [63:0] lane_word = word1 >> {lane1, 4'b0};
+    wire [15:0] ovl_pix = lane_word[15:0];
+    wire show = in1 && !(key_l && ovl_pix == key565_l);
+
+    /* stage 2: composited pixel */
+    always @(posedge pclk)
+        pix_o <= show ? blend565(ovl_pix, pix_i, alpha_l) : pix_i;
+
+endmodule /* FB_Overlay */
+
+/* Character-cell text layer, mixed into the scanout pixel stream.
+ * The cell RAM holds TXT_ROWS rows of 128 cells {attr, char}, attr is
+ * {bg[3:0], fg[3:0]} into a 16 entry RGB565 palette; the font ROM holds
+ * the 128 ASCII glyphs as 16 rows of 16 bits, leftmost pixel in bit 15.
+ * The cell position runs one pixel ahead of the linebuffer address so the
+ * cell RAM and font ROM reads (one pclk each) line up with pix_i.
+ * txt_ctrl: bit0 enable, bit1 cursor, bit2 cursor blink, bit3 bg color 0
+ * is transparent. txt_cursor: col [6:0], row [21:16]. txt_scroll: cell
+ * row shown at the top of the screen [5:0]. */
+module FB_TextLayer #(
+    parameter H_MAX = 11'd1432,
+    parameter CELL_W = 4'd10,
+    parameter CELL_H = 4'd15,
+    parameter TXT_ROWS = 6'd40
+) (
+    input pclk,
+    input [10:0] counter_x,
+    input [9:0] counter_y,
+
+    input cell_clk,
+    input cell_we,
+    input [12:0] cell_waddr,
+    input [15:0] cell_wdata,
+
+    input [31:0] txt_ctrl,
+    input [31:0] txt_cursor,
+    input [31:0] txt_scroll,
+    input [255:0] txt_palette,
+
+    input [15:0] pix_i,
+    output [15:0] pix_o
+);
+    reg [15:0] cell_ram[0:128*TXT_ROWS-1];
+    reg [15:0] font_rom[0:2047];
+
+    initial $readmemh("../hw/fbtext_font10x15.mem", font_rom);
+
+    always @(posedge cell_clk)
+        if (cell_we) cell_ram[cell_waddr] <= cell_wdata;
+
+    /* cell position of the pixel after the one addressed in the linebuffer */
+    reg [6:0] col;
+    reg [3:0] subx;
+    reg [5:0] row;
+    reg [3:0] gy;
+    reg [5:0] frame_cnt;
+
+    always @(posedge pclk) begin
+        if (counter_x == H_MAX - 1'b1) begin
+            col  <= 0;
+            subx <= 0;
+            if (counter_y == 0) begin
+                /* next line is the first visible one */
+                row       <= txt_scroll[5:0];
+                gy        <= 0;
+                frame_cnt <= frame_cnt + 1'b1;
+            end else if (gy == CELL_H - 1'b1) begin
+                gy  <= 0;
+                row <= (row == TXT_ROWS - 1'b1) ? 6'd0 : row + 1'b1;
+            end else
+                gy <= gy + 1'b1;
+        end else if (subx == CELL_W - 1'b1) begin
+            subx <= 0;
+            col  <= col + 1'b1;
+        end else
+            subx <= subx + 1'b1;
+    end
+
+    /* stage 1: cell RAM read */
+    reg [15:0] cell_q;
+    reg [3:0] subx_1, gy_1;
+    reg cursor_1;
+
+    always @(posedge pclk) begin
+        cell_q   <= cell_ram[{row, col}];
+        subx_1   <= subx;
+        gy_1     <= gy;
+        cursor_1 <= (col == txt_cursor[6:0]) && (row == txt_cursor[21:16]);
+    end
+
+    /* stage 2: font ROM read */
+    reg [15:0] glyph_row;
+    reg [7:0] attr_2;
+    reg [3:0] subx_2;
+    reg cursor_2;
+
+    always @(posedge pclk) begin
+        glyph_row <= font_rom[{cell_q[6:0], gy_1}];
+        attr_2    <= cell_q[15:8];
+        subx_2    <= subx_1;
+        cursor_2  <= cursor_1;
+    end
+
+    /* stage 3: color, mixed combinationally with the linebuffer pixel */
+    wire cursor_on = txt_ctrl[1] & cursor_2 & (~txt_ctrl[2] | frame_cnt[5]);
+    wire fg_pix = glyph_row[4'd15 - subx_2] ^ cursor_on;
+    wire [3:0] cidx = fg_pix ? attr_2[3:0] : attr_2[7:4];
+    wire see_through = txt_ctrl[3] & ~fg_pix & (cidx == 4'd0);
+
+    assign pix_o = (txt_ctrl[0] & ~see_through) ? txt_palette[{cidx, 4'b0}+:16] : pix_i;
+
+endmodule /* FB_TextLayer */
+
+/* Hardware sprites, composited over the text layer at scanout.
+ * SPR_COUNT sprites of 32x32 RGB565, each in its own BSRAM so all of them
+ * are read every pixel; pixels equal to the key color are transparent and
+ * sprite 0 is on top. Enables and positions are latched at the start of a
+ * frame, so a move written during scanout shows up whole in the next one.
+ * spr_pos: {y[27:16], x[11:0]} per sprite, signed to allow partly off the
+ * left/top edge. Same one pixel lookahead as FB_TextLayer, plus one
+ * register stage after the RAM read for the key compare. */
+module FB_Sprites #(
+    parameter H_MAX = 11'd1432,
+    parameter SPR_COUNT = 4
+) (
+    input pclk,
+    input [10:0] counter_x,
+    input [9:0] counter_y,
+
+    input spr_clk,
+    input spr_we,
+    input [11:0] spr_waddr,
+    input [15:0] spr_wdata,
+
+    input [31:0] spr_enable,
+    input [31:0] spr_key,
+    input [32*SPR_COUNT-1:0] spr_pos,
+
+    input [15:0] pix_i,
+    output [15:0] pix_o
+);
+    /* screen position of the pixel after the one addressed in the linebuffer */
+    reg [10:0] qx;
+    reg [9:0] sline;
+    reg [SPR_COUNT-1:0] en_l;
+    reg [32*SPR_COUNT-1:0] pos_l;
+
+    always @(posedge pclk) begin
+        if (counter_x == H_MAX - 1'b1) begin
+            qx    <= 0;
+            sline <= counter_y;
+            if (counter_y == 0) begin
+                en_l  <= spr_enable[SPR_COUNT-1:0];
+                pos_l <= spr_pos;
+            end
+        end else
+            qx <= qx + 1'b1;
+    end
+
+    wire [SPR_COUNT-1:0] hit;
+    wire [15:0] color[0:SPR_COUNT-1];
+
+    genvar i;
+    generate
+        for (i = 0; i < SPR_COUNT; i = i + 1) begin : gen_sprite
+            reg [15:0] ram[0:1023];
+            reg [15:0] q1, q2;
+            reg in1, opaque2;
+
+            wire [11:0] dx = {1'b0, qx} - pos_l[i*32+:12];
+            wire [11:0] dy = {2'b0, sline} - pos_l[i*32+16+:12];
+            wire inside = en_l[i] && (dx[11:5] == 0) && (dy[11:5] == 0);
+
+            always @(posedge spr_clk)
+                if (spr_we && spr_waddr[11:10] == i) ram[spr_waddr[9:0]] <= spr_wdata;
+
+            always @(posedge pclk) begin
+                q1      <= ram[{dy[4:0], dx[4:0]}];
+                in1     <= inside;
+                q2      <= q1;
+                opaque2 <= in1 && (q1 != spr_key[15:0]);
+            end
+
+            assign hit[i]   = opaque2;
+            assign color[i] = q2;
+        end
+    endgenerate
+
+    /* lowest numbered sprite on top */
+    reg [15:0] mix;
+    integer k;
+    always @* begin
+        mix = pix_i;
+        for (k = SPR_COUNT - 1; k >= 0; k = k - 1)
+            if (hit[k]) mix = color[k];
+    end
+    assign pix_o = mix;
+
+endmodule /* FB_Sprites */
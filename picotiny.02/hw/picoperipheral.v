@@ -222,6 +222,63 @@ picos3_sel ? picos3_ready :
 endmodule
 
 
+/* Two masters on one bus. A transfer keeps the bus until ready, masters
+ * waiting at the same time take turns. The grant is combinational while
+ * the bus is idle, so a master alone costs no extra cycle. */
+module PicoMem_Arb_2_1 (
+    input clk,
+    input resetn,
+    input picom0_valid,
+    input [31:0] picom0_addr,
+    input [31:0] picom0_wdata,
+    input [3:0] picom0_wstrb,
+    input picom1_valid,
+    input [31:0] picom1_addr,
+    input [31:0] picom1_wdata,
+    input [3:0] picom1_wstrb,
+    input picos_ready,
+    input [31:0] picos_rdata,
+    output picom0_ready,
+    output [31:0] picom0_rdata,
+    output picom1_ready,
+    output [31:0] picom1_rdata,
+    output picos_valid,
+    output [31:0] picos_addr,
+    output [31:0] picos_wdata,
+    output [3:0] picos_wstrb
+);
+    reg active;  // a transfer is under way
+    reg owner;   // its master
+    reg last;    // the master granted last
+    wire sel = active ? owner : (picom1_valid && (!picom0_valid || !last));
+
+    always @(posedge clk) begin
+        if (!resetn) begin
+            active <= 1'b0;
+            owner  <= 1'b0;
+            last   <= 1'b0;
+        end else if (!active) begin
+            if (picos_valid && !picos_ready) begin
+                active <= 1'b1;
+                owner  <= sel;
+            end
+            if (picos_valid) last <= sel;
+        end else if (picos_ready) begin
+            active <= 1'b0;
+        end
+    end
+
+    assign picos_valid  = sel ? picom1_valid : picom0_valid;
+    assign picos_addr   = sel ? picom1_addr : picom0_addr;
+    assign picos_wdata  = sel ? picom1_wdata : picom0_wdata;
+    assign picos_wstrb  = sel ? picom1_wstrb : picom0_wstrb;
+    assign picom0_ready = !sel && picos_ready;
+    assign picom1_ready = sel && picos_ready;
+    assign picom0_rdata = picos_rdata;
+    assign picom1_rdata = picos_rdata;
+endmodule
+
+
 
 module PicoMem_115200_UART_27M #(
     parameter BAUDGEN_HZ = 27000000,
@@ -452,3 +509,296 @@ module PicoMem_115200_UART_27M #(
     end
 
 endmodule
+
+
+/* Descriptor DMA: copies lines of words between the memories of the bus
+ * (flash, SRAM, PSRAM) along a chain of descriptors, 5 words each wherever
+ * the bus reads them: {src, dst, {lines, bytes per line}, {src stride,
+ * dst stride}, next}, next 0 ends the chain, 0 lines is one. Addresses,
+ * counts and strides are multiples of 4, and flash is no destination.
+ * Words go over the bus as a second master, except PSRAM, which moves in
+ * 32-byte blocks through the block port of the framebuffer: a source
+ * block is read once for its 8 words, destination words are merged into
+ * a block that is written with one masked command once the copy leaves
+ * it (or the descriptor ends). Block requests toggle blk_req with the
+ * block held, blk_ack toggles back in the PSRAM clock when it is done.
+ * Registers: 0 ctrl (writes START, IRQ_EN, ABORT, reads {error, done,
+ * irq_en, busy}), 1 first descriptor, 2 current one, 3 bytes moved, 4 id.
+ * irq is done with irq_en, a write of ctrl clears done. */
+module PicoMem_DMA #(
+    parameter DMA_ID = 32'h444D_4131  // "DMA1"
+) (
+    input clk,
+    input resetn,
+
+    input mem_s_valid,
+    input [31:0] mem_s_addr,
+    input [31:0] mem_s_wdata,
+    input [3:0] mem_s_wstrb,
+    output mem_s_ready,
+    output [31:0] mem_s_rdata,
+
+    output mem_m_valid,
+    output [31:0] mem_m_addr,
+    output [31:0] mem_m_wdata,
+    output [3:0] mem_m_wstrb,
+    input mem_m_ready,
+    input [31:0] mem_m_rdata,
+
+    output blk_req,
+    output blk_we,
+    output [22:0] blk_addr,
+    output [255:0] blk_wdata,
+    output [31:0] blk_wbytes,
+    input blk_ack,
+    input [255:0] blk_rdata,
+
+    output irq
+);
+    localparam S_IDLE = 3'd0;
+    localparam S_DESC = 3'd1;
+    localparam S_SETUP = 3'd2;
+    localparam S_READ = 3'd3;
+    localparam S_WRITE = 3'd4;
+    localparam S_BLKRD = 3'd5;
+    localparam S_FLUSH = 3'd6;
+    localparam S_NEXT = 3'd7;
+
+    reg ready_r;
+    reg [31:0] rdata_r;
+    reg [2:0] state, flush_ret;
+    reg busy, done, err, irq_en, abort;
+    reg [31:0] first_reg, cur, moved;
+    reg [31:0] desc[0:4];
+    reg [2:0] didx;
+    reg [31:0] src_line, dst_line;
+    reg [15:0] pos, lines_left;
+    reg [31:0] data;
+    reg m_valid;
+    reg [31:0] m_addr, m_wdata;
+    reg [3:0] m_wstrb;
+    reg req_r, we_r, blk_wait;
+    reg [1:0] ack_sr;
+    reg [22:0] baddr_r;
+    reg [255:0] rbuf, wbuf;
+    reg [17:0] rtag, wtag;
+    reg rvalid, wdirty;
+    reg [31:0] wbytes;
+
+    wire blk_done = (ack_sr[1] == req_r);
+    wire [15:0] d_bytes = desc[2][15:0];
+    wire [15:0] d_lines = (desc[2][31:16] == 16'd0) ? 16'd1 : desc[2][31:16];
+    wire [31:0] src_a = src_line + pos;
+    wire [31:0] dst_a = dst_line + pos;
+    wire src_psram = (src_a[31:24] == 8'hC0);
+    wire dst_psram = (dst_a[31:24] == 8'hC0);
+    wire line_end = ({1'b0, pos} + 17'd4 >= {1'b0, d_bytes});
+    wire desc_bad = (desc[0][1:0] != 2'd0) || (desc[1][1:0] != 2'd0) ||
+                    (desc[2][1:0] != 2'd0) || (desc[3][17:16] != 2'd0) ||
+                    (desc[3][1:0] != 2'd0) || (desc[1][31:30] == 2'd0);
+
+    always @(posedge clk) begin
+        if (!resetn) begin
+            ready_r   <= 1'b0;
+            state     <= S_IDLE;
+            busy      <= 1'b0;
+            done      <= 1'b0;
+            err       <= 1'b0;
+            irq_en    <= 1'b0;
+            abort     <= 1'b0;
+            first_reg <= 32'b0;
+            cur       <= 32'b0;
+            moved     <= 32'b0;
+            m_valid   <= 1'b0;
+            req_r     <= 1'b0;
+            we_r      <= 1'b0;
+            blk_wait  <= 1'b0;
+            ack_sr    <= 2'b0;
+            rvalid    <= 1'b0;
+            wdirty    <= 1'b0;
+            wbytes    <= 32'b0;
+        end else begin
+            ack_sr  <= {ack_sr[0], blk_ack};
+            ready_r <= 1'b0;
+            if (mem_s_valid && !ready_r) begin
+                ready_r <= 1'b1;
+                case (mem_s_addr[4:2])
+                    0: begin
+                        if (mem_s_wstrb[0]) begin
+                            irq_en <= mem_s_wdata[1];
+                            done   <= 1'b0;
+                            if (mem_s_wdata[2] && busy) abort <= 1'b1;
+                            if (mem_s_wdata[0] && !busy) begin
+                                busy  <= 1'b1;
+                                err   <= 1'b0;
+                                moved <= 32'b0;
+                                cur   <= first_reg;
+                                didx  <= 3'd0;
+                                state <= S_DESC;
+                            end
+                        end
+                        rdata_r <= {28'b0, err, done, irq_en, busy};
+                    end
+                    1: begin
+                        if (mem_s_wstrb[3]) first_reg[31:24] <= mem_s_wdata[31:24];
+                        if (mem_s_wstrb[2]) first_reg[23:16] <= mem_s_wdata[23:16];
+                        if (mem_s_wstrb[1]) first_reg[15:8] <= mem_s_wdata[15:8];
+                        if (mem_s_wstrb[0]) first_reg[7:0] <= mem_s_wdata[7:0];
+                        rdata_r <= first_reg;
+                    end
+                    2: rdata_r <= cur;
+                    3: rdata_r <= moved;
+                    4: rdata_r <= DMA_ID;
+                    default: rdata_r <= 32'h0;
+                endcase
+            end
+
+            case (state)
+                S_DESC: begin
+                    /* the 5 words of descriptor cur */
+                    if (!m_valid) begin
+                        m_valid <= 1'b1;
+                        m_addr  <= cur + {didx, 2'b0};
+                        m_wstrb <= 4'b0;
+                    end else if (mem_m_ready) begin
+                        m_valid    <= 1'b0;
+                        desc[didx] <= mem_m_rdata;
+                        didx       <= didx + 1'b1;
+                        if (didx == 3'd4) state <= S_SETUP;
+                    end
+                end
+                S_SETUP: begin
+                    src_line   <= desc[0];
+                    dst_line   <= desc[1];
+                    pos        <= 16'd0;
+                    lines_left <= d_lines;
+                    /* the source may have changed since the last one */
+                    rvalid     <= 1'b0;
+                    if (desc_bad) begin
+                        err   <= 1'b1;
+                        abort <= 1'b0;
+                        busy  <= 1'b0;
+                        done  <= 1'b1;
+                        state <= S_IDLE;
+                    end else if (d_bytes == 16'd0) begin
+                        state <= S_NEXT;
+                    end else begin
+                        state <= S_READ;
+                    end
+                end
+                S_READ: begin
+                    if (abort && !m_valid) begin
+                        state <= S_NEXT;
+                    end else if (src_psram) begin
+                        if (wdirty && wtag == src_a[22:5]) begin
+                            /* copying within PSRAM, the merged block goes first */
+                            flush_ret <= S_READ;
+                            state     <= S_FLUSH;
+                        end else if (rvalid && rtag == src_a[22:5]) begin
+                            data  <= rbuf[32*src_a[4:2]+:32];
+                            state <= S_WRITE;
+                        end else begin
+                            req_r   <= ~req_r;
+                            we_r    <= 1'b0;
+                            baddr_r <= {src_a[22:5], 5'b0};
+                            rtag    <= src_a[22:5];
+                            state   <= S_BLKRD;
+                        end
+                    end else if (!m_valid) begin
+                        m_valid <= 1'b1;
+                        m_addr  <= src_a;
+                        m_wstrb <= 4'b0;
+                    end else if (mem_m_ready) begin
+                        m_valid <= 1'b0;
+                        data    <= mem_m_rdata;
+                        state   <= S_WRITE;
+                    end
+                end
+                S_BLKRD: begin
+                    if (blk_done) begin
+                        rbuf   <= blk_rdata;
+                        rvalid <= 1'b1;
+                        state  <= S_READ;
+                    end
+                end
+                S_WRITE: begin
+                    if (dst_psram && wdirty && wtag != dst_a[22:5]) begin
+                        flush_ret <= S_WRITE;
+                        state     <= S_FLUSH;
+                    end else if (!dst_psram && !m_valid) begin
+                        m_valid <= 1'b1;
+                        m_addr  <= dst_a;
+                        m_wdata <= data;
+                        m_wstrb <= 4'hf;
+                    end else if (dst_psram || mem_m_ready) begin
+                        if (dst_psram) begin
+                            wbuf[32*dst_a[4:2]+:32]  <= data;
+                            wbytes[4*dst_a[4:2]+:4] <= 4'hf;
+                            wtag                     <= dst_a[22:5];
+                            wdirty                   <= 1'b1;
+                        end
+                        m_valid <= 1'b0;
+                        moved   <= moved + 3'd4;
+                        if (!line_end) begin
+                            pos   <= pos + 3'd4;
+                            state <= S_READ;
+                        end else if (lines_left != 16'd1) begin
+                            lines_left <= lines_left - 1'b1;
+                            pos        <= 16'd0;
+                            src_line   <= src_line + desc[3][31:16];
+                            dst_line   <= dst_line + desc[3][15:0];
+                            state      <= S_READ;
+                        end else begin
+                            state <= S_NEXT;
+                        end
+                    end
+                end
+                S_FLUSH: begin
+                    /* write the merged destination block */
+                    if (!blk_wait) begin
+                        blk_wait <= 1'b1;
+                        req_r    <= ~req_r;
+                        we_r     <= 1'b1;
+                        baddr_r  <= {wtag, 5'b0};
+                    end else if (blk_done) begin
+                        blk_wait <= 1'b0;
+                        wdirty   <= 1'b0;
+                        wbytes   <= 32'b0;
+                        if (rtag == wtag) rvalid <= 1'b0;
+                        state <= flush_ret;
+                    end
+                end
+                S_NEXT: begin
+                    if (wdirty) begin
+                        flush_ret <= S_NEXT;
+                        state     <= S_FLUSH;
+                    end else if (desc[4] == 32'b0 || abort) begin
+                        err   <= err | abort;
+                        abort <= 1'b0;
+                        busy  <= 1'b0;
+                        done  <= 1'b1;
+                        state <= S_IDLE;
+                    end else begin
+                        cur   <= desc[4];
+                        didx  <= 3'd0;
+                        state <= S_DESC;
+                    end
+                end
+                default: ;
+            endcase
+        end
+    end
+
+    assign mem_s_ready = ready_r;
+    assign mem_s_rdata = rdata_r;
+    assign mem_m_valid = m_valid;
+    assign mem_m_addr  = m_addr;
+    assign mem_m_wdata = m_wdata;
+    assign mem_m_wstrb = m_wstrb;
+    assign blk_req     = req_r;
+    assign blk_we      = we_r;
+    assign blk_addr    = baddr_r;
+    assign blk_wdata   = wbuf;
+    assign blk_wbytes  = wbytes;
+    assign irq         = done && irq_en;
+endmodule
@@ -37,6 +37,21 @@ module picotiny (
 
     wire sys_resetn;
 
+    wire cpu_valid;
+    wire cpu_ready;
+    wire [31:0] cpu_addr;
+    wire [31:0] cpu_wdata;
+    wire [3:0] cpu_wstrb;
+    wire [31:0] cpu_rdata;
+
+    wire dma_valid;
+    wire dma_ready;
+    wire [31:0] dma_addr;
+    wire [31:0] dma_wdata;
+    wire [3:0] dma_wstrb;
+    wire [31:0] dma_rdata;
+    wire dma_irq;
+
     wire mem_valid;
     wire mem_ready;
     wire [31:0] mem_addr;
@@ -132,17 +147,44 @@ module picotiny (
         .clk(clk_cpu),
         .resetn(sys_resetn),
         .trap(),
-        .mem_valid(mem_valid),
+        .mem_valid(cpu_valid),
         .mem_instr(),
-        .mem_ready(mem_ready),
-        .mem_addr(mem_addr),
-        .mem_wdata(mem_wdata),
-        .mem_wstrb(mem_wstrb),
-        .mem_rdata(mem_rdata),
-        .irq(32'b0),
+        .mem_ready(cpu_ready),
+        .mem_addr(cpu_addr),
+        .mem_wdata(cpu_wdata),
+        .mem_wstrb(cpu_wstrb),
+        .mem_rdata(cpu_rdata),
+        .irq({28'b0, dma_irq, 3'b0}),
         .eoi()
     );
 
+    // M0 CPU, M1 DMA
+    PicoMem_Arb_2_1 u_PicoMem_Arb_2_1 (
+        .clk(clk_cpu),
+        .resetn(sys_resetn),
+
+        .picom0_valid(cpu_valid),
+        .picom0_ready(cpu_ready),
+        .picom0_addr (cpu_addr),
+        .picom0_wdata(cpu_wdata),
+        .picom0_wstrb(cpu_wstrb),
+        .picom0_rdata(cpu_rdata),
+
+        .picom1_valid(dma_valid),
+        .picom1_ready(dma_ready),
+        .picom1_addr (dma_addr),
+        .picom1_wdata(dma_wdata),
+        .picom1_wstrb(dma_wstrb),
+        .picom1_rdata(dma_rdata),
+
+        .picos_valid(mem_valid),
+        .picos_ready(mem_ready),
+        .picos_addr (mem_addr),
+        .picos_wdata(mem_wdata),
+        .picos_wstrb(mem_wstrb),
+        .picos_rdata(mem_rdata)
+    );
+
     PicoMem_SRAM_8KB u_PicoMem_SRAM_8KB_7 (
         .clk(clk_cpu),
         .resetn(sys_resetn),
@@ -309,10 +351,10 @@ module picotiny (
 
 
 
-    // WBP_S0 0x8000_0000 -> PSRAM
-    // WBP_S1 0x8100_0000 -> LCD FB Regs
-    // WBP_S2 0x8200_0000 -> My peripherals
-    // WBP_S3 0x8300_0000 -> Spare
+    // WBP_S0 0xC000_0000 -> PSRAM
+    // WBP_S1 0xC100_0000 -> LCD FB Regs
+    // WBP_S2 0xC200_0000 -> My peripherals
+    // WBP_S3 0xC300_0000 -> DMA
     wire psram_valid;
     wire psram_ready;
     wire [31:0] psram_addr;
@@ -337,6 +379,13 @@ module picotiny (
     wire [31:0] wbp3_rdata;
     wire [31:0] wbp3_wdata;
     wire [3:0] wbp3_wstrb;
+    wire blk_req;
+    wire blk_we;
+    wire [22:0] blk_addr;
+    wire [255:0] blk_wdata;
+    wire [31:0] blk_wbytes;
+    wire blk_ack;
+    wire [255:0] blk_rdata;
 
     // Spare WBP Address Space decoding
     PicoMem_Mux_1_4 #(
@@ -387,8 +436,8 @@ module picotiny (
 
     // assign wbp2_ready = 1'b1;
     // assign wbp2_rdata = 32'hEFBEADDE;  //DEADBEEF
-    assign wbp3_ready = 1'b1;
-    assign wbp3_rdata = 32'h0FB00DD0;  //D00DB00F
+    // assign wbp3_ready = 1'b1;
+    // assign wbp3_rdata = 32'h0FB00DD0;  //D00DB00F
 
     assign LCD_CLK = clk_cpu;
     PSRAM_FRAMEBUFFER_LCD D1 (
@@ -423,6 +472,14 @@ module picotiny (
         .mem_s_wstrb(psram_wstrb),
         .mem_s_rdata(psram_rdata),
 
+        .dma_req   (blk_req),
+        .dma_we    (blk_we),
+        .dma_addr  (blk_addr),
+        .dma_wdata (blk_wdata),
+        .dma_wbytes(blk_wbytes),
+        .dma_ack   (blk_ack),
+        .dma_rdata (blk_rdata),
+
         .O_psram_ck(O_psram_ck),
         .O_psram_ck_n(O_psram_ck_n),
         .IO_psram_dq(IO_psram_dq),
@@ -443,4 +500,33 @@ module picotiny (
         .mem_wstrb(wbp2_wstrb),
         .mem_rdata(wbp2_rdata)
     );
+
+    PicoMem_DMA u_PicoMem_DMA (
+        .clk(clk_cpu),
+        .resetn(sys_resetn),
+
+        .mem_s_valid(wbp3_valid),
+        .mem_s_ready(wbp3_ready),
+        .mem_s_addr (wbp3_addr),
+        .mem_s_wdata(wbp3_wdata),
+        .mem_s_wstrb(wbp3_wstrb),
+        .mem_s_rdata(wbp3_rdata),
+
+        .mem_m_valid(dma_valid),
+        .mem_m_ready(dma_ready),
+        .mem_m_addr (dma_addr),
+        .mem_m_wdata(dma_wdata),
+        .mem_m_wstrb(dma_wstrb),
+        .mem_m_rdata(dma_rdata),
+
+        .blk_req   (blk_req),
+        .blk_we    (blk_we),
+        .blk_addr  (blk_addr),
+        .blk_wdata (blk_wdata),
+        .blk_wbytes(blk_wbytes),
+        .blk_ack   (blk_ack),
+        .blk_rdata (blk_rdata),
+
+        .irq(dma_irq)
+    );
 endmodule
@@ -0,0 +1,550 @@
+/*
+ * fontconv - converts GLCD (openGLCD/SSD1306Ascii) font headers or BDF fonts
+ * into the picotiny blit-ready font format (see appmon/src/fbfont.h).
+ *
+ * The GLCD fonts store each glyph column-major in 8-row pages, so a renderer
+ * has to transpose every glyph at draw time. The output here is row-major,
+ * every glyph row starts on a byte boundary, and the glyph table holds the
+ * direct offset of each glyph so the target never has to sum up widths.
+ *
+ * TTF/OTF fonts are not read directly (no FreeType on the host side needed):
+ * rasterize them to BDF first, e.g. "otf2bdf -p 30 font.ttf > font30.bdf",
+ * then use -d to box-filter the large rasterization down into a 2/4-bpp
+ * anti-aliased font.
+ */
+#include <stdio.h>
+#include <ctype.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#define FBF_MAGIC		  "PTF1"
+#define FBF_HDR_SIZE	  16
+#define FBF_GLYPH_SIZE	  8
+#define FBF_FLAG_PROPORTIONAL 0x0001
+
+#define MAX_GLYPHS		 256
+#define MAX_SRC_BYTES	 (256 * 1024)
+
+/* GLCD header indices, same as allFonts.h */
+#define FONT_LENGTH		 0
+#define FONT_WIDTH		 2
+#define FONT_HEIGHT		 3
+#define FONT_FIRST_CHAR	 4
+#define FONT_CHAR_COUNT	 5
+#define FONT_WIDTH_TABLE 6
+
+typedef struct {
+	int		 present;
+	int		 width;
+	int		 advance;
+	uint8_t *cov; /* width * height coverage values, 0..255 */
+} GLYPH;
+
+typedef struct {
+	int	  height;
+	int	  first_char;
+	int	  char_count;
+	int	  proportional;
+	GLYPH glyph[MAX_GLYPHS];
+} FONT;
+
+static void die(const char *fmt, const char *arg)
+{
+	fprintf(stderr, "fontconv: ");
+	fprintf(stderr, fmt, arg);
+	fprintf(stderr, "\n");
+	exit(1);
+}
+
+static uint8_t *xcalloc(size_t n)
+{
+	uint8_t *p = calloc(n ? n : 1, 1);
+	if (p == NULL)
+		die("%s", "out of memory");
+	return p;
+}
+
+static char *read_file(const char *fname)
+{
+	FILE *fp = fopen(fname, "rb");
+	if (fp == NULL)
+		die("cannot open %s", fname);
+	fseek(fp, 0, SEEK_END);
+	long len = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	char *buf = (char *)xcalloc(len + 1);
+	if (fread(buf, 1, len, fp) != (size_t)len)
+		die("read error on %s", fname);
+	fclose(fp);
+	return buf;
+}
+
+/*
+ * Pulls the byte array out of a GLCDFONTDECL(name) = { ... }; declaration,
+ * skipping C/C++ comments. Returns the number of bytes found.
+ */
+static int parse_glcd_array(char *src, uint8_t *out, int maxlen)
+{
+	char *p = strstr(src, "GLCDFONTDECL");
+	int	  n = 0;
+
+	if (p == NULL || (p = strchr(p, '{')) == NULL)
+		return -1;
+	p++;
+	while (*p && *p != '}') {
+		if (p[0] == '/' && p[1] == '/') {
+			while (*p && *p != '\n')
+				p++;
+		}
+		else if (p[0] == '/' && p[1] == '*') {
+			p = strstr(p + 2, "*/");
+			if (p == NULL)
+				return -1;
+			p += 2;
+		}
+		else if (isdigit((unsigned char)*p)) {
+			char *end;
+			long  v = strtol(p, &end, 0);
+			if (n >= maxlen)
+				return -1;
+			out[n++] = (uint8_t)v;
+			p = end;
+		}
+		else {
+			p++;
+		}
+	}
+	return n;
+}
+
+static void load_glcd(FONT *font, const char *fname)
+{
+	char	*src = read_file(fname);
+	uint8_t *f = xcalloc(MAX_SRC_BYTES);
+	int		 len = parse_glcd_array(src, f, MAX_SRC_BYTES);
+
+	if (len < FONT_WIDTH_TABLE)
+		die("no GLCDFONTDECL array found in %s", fname);
+
+	uint16_t font_l = (f[FONT_LENGTH] << 8) + f[FONT_LENGTH + 1];
+	int		 font_w = f[FONT_WIDTH];
+	int		 font_h = f[FONT_HEIGHT];
+	int		 pages = (font_h + 7) / 8;
+	/* openGLCD shifts the last page down so the bottom row lands on bit 7 */
+	int		 last_shift = pages * 8 - font_h;
+	uint8_t *widths = NULL;
+	int		 p = FONT_WIDTH_TABLE;
+
+	font->height = font_h;
+	font->first_char = f[FONT_FIRST_CHAR];
+	font->char_count = f[FONT_CHAR_COUNT];
+	font->proportional = font_l > 1;
+	if (font->proportional) {
+		widths = &f[FONT_WIDTH_TABLE];
+		p += font->char_count;
+	}
+
+	for (int i = 0; i < font->char_count; i++) {
+		int	   c = font->first_char + i;
+		int	   w = widths ? widths[i] : font_w;
+		GLYPH *g = &font->glyph[c & 0xff];
+
+		if (p + w * pages > len)
+			die("%s: glyph data truncated", fname);
+		g->present = 1;
+		g->width = w;
+		/* same spacing rule as plot_char(): variable width fonts get
+		 * the implicit empty column on the right */
+		g->advance = w + (font->proportional ? 1 : 0);
+		g->cov = xcalloc(w * font_h);
+		for (int y = 0; y < font_h; y++) {
+			int page = y / 8;
+			int bit = y % 8;
+			if (page == pages - 1)
+				bit = y - page * 8 + last_shift;
+			for (int x = 0; x < w; x++) {
+				if (f[p + page * w + x] & (1 << bit))
+					g->cov[y * w + x] = 255;
+			}
+		}
+		p += w * pages;
+	}
+	free(f);
+	free(src);
+}
+
+static void load_bdf(FONT *font, const char *fname)
+{
+	char  *src = read_file(fname);
+	char  *line = strtok(src, "\n");
+	int	   bbx_w = 0, bbx_h = 0, bbx_xo = 0, bbx_yo = 0;
+	int	   ascent = -1, descent = -1;
+	int	   enc = -1, dwidth = 0;
+	int	   gw = 0, gh = 0, gxo = 0, gyo = 0;
+	int	   in_bitmap = 0, row = 0;
+	int	   lo = 255, hi = 0;
+	GLYPH *g = NULL;
+
+	for (; line != NULL; line = strtok(NULL, "\n")) {
+		if (in_bitmap) {
+			if (strncmp(line, "ENDCHAR", 7) == 0) {
+				in_bitmap = 0;
+				continue;
+			}
+			if (g == NULL) /* glyph outside 8-bit range */
+				continue;
+			int top = ascent - (gyo + gh);
+			int y = top + row++;
+			int nbits = ((int)strlen(line)) * 4;
+			for (int x = 0; x < gw && x < nbits; x++) {
+				int nib = line[x / 4];
+				nib = isdigit(nib) ? nib - '0' : (toupper(nib) - 'A' + 10);
+				if ((nib >> (3 - (x % 4))) & 1) {
+					int px = gxo + x;
+					if (y >= 0 && y < font->height && px >= 0 && px < g->width)
+						g->cov[y * g->width + px] = 255;
+				}
+			}
+			continue;
+		}
+		if (sscanf(line, "FONTBOUNDINGBOX %d %d %d %d",
+				   &bbx_w, &bbx_h, &bbx_xo, &bbx_yo) == 4)
+			continue;
+		if (sscanf(line, "FONT_ASCENT %d", &ascent) == 1)
+			continue;
+		if (sscanf(line, "FONT_DESCENT %d", &descent) == 1)
+			continue;
+		if (sscanf(line, "ENCODING %d", &enc) == 1)
+			continue;
+		if (sscanf(line, "DWIDTH %d", &dwidth) == 1)
+			continue;
+		if (sscanf(line, "BBX %d %d %d %d", &gw, &gh, &gxo, &gyo) == 4)
+			continue;
+		if (strncmp(line, "BITMAP", 6) == 0) {
+			if (ascent < 0)
+				ascent = bbx_h + bbx_yo;
+			if (descent < 0)
+				descent = -bbx_yo;
+			font->height = ascent + descent;
+			in_bitmap = 1;
+			row = 0;
+			g = NULL;
+			if (enc >= 0 && enc < MAX_GLYPHS) {
+				g = &font->glyph[enc];
+				g->present = 1;
+				g->advance = dwidth;
+				/* no negative bearing in the format, shift the bitmap right */
+				if (gxo < 0)
+					gxo = 0;
+				g->width = dwidth > gxo + gw ? dwidth : gxo + gw;
+				g->cov = xcalloc(g->width * font->height);
+				lo = enc < lo ? enc : lo;
+				hi = enc > hi ? enc : hi;
+			}
+		}
+	}
+	if (lo > hi)
+		die("no usable glyphs in %s", fname);
+	font->first_char = lo;
+	font->char_count = hi - lo + 1;
+	font->proportional = 1;
+	free(src);
+}
+
+/* Integer upscale by pixel replication, for the larger display sizes */
+static void upscale(FONT *font, int factor)
+{
+	for (int c = 0; c < MAX_GLYPHS; c++) {
+		GLYPH *g = &font->glyph[c];
+		if (!g->present)
+			continue;
+		int		 nw = g->width * factor;
+		uint8_t *ncov = xcalloc(nw * font->height * factor);
+		for (int y = 0; y < font->height * factor; y++)
+			for (int x = 0; x < nw; x++)
+				ncov[y * nw + x] = g->cov[(y / factor) * g->width + x / factor];
+		free(g->cov);
+		g->cov = ncov;
+		g->width = nw;
+		g->advance *= factor;
+	}
+	font->height *= factor;
+}
+
+/* Box-filter downsample, this is where the anti-aliasing coverage comes from */
+static void downsample(FONT *font, int factor)
+{
+	int nh = (font->height + factor - 1) / factor;
+	for (int c = 0; c < MAX_GLYPHS; c++) {
+		GLYPH *g = &font->glyph[c];
+		if (!g->present)
+			continue;
+		int		 nw = (g->width + factor - 1) / factor;
+		uint8_t *ncov = xcalloc(nw * nh);
+		for (int y = 0; y < nh; y++) {
+			for (int x = 0; x < nw; x++) {
+				int sum = 0;
+				for (int j = 0; j < factor; j++) {
+					for (int i = 0; i < factor; i++) {
+						int sy = y * factor + j, sx = x * factor + i;
+						if (sy < font->height && sx < g->width)
+							sum += g->cov[sy * g->width + sx];
+					}
+				}
+				ncov[y * nw + x] = sum / (factor * factor);
+			}
+		}
+		free(g->cov);
+		g->cov = ncov;
+		g->width = nw;
+		g->advance = (g->advance + factor - 1) / factor;
+	}
+	font->height = nh;
+}
+
+static void put_le16(uint8_t *p, uint32_t v)
+{
+	p[0] = v;
+	p[1] = v >> 8;
+}
+
+static void put_le32(uint8_t *p, uint32_t v)
+{
+	put_le16(p, v);
+	put_le16(p + 2, v >> 16);
+}
+
+/*
+ * Builds the blit-ready image: FBF_HDR_SIZE bytes of header, the glyph table
+ * (char_count entries) and then the row-major glyph bitmaps, pixels packed
+ * MSB-first, every row padded up to a byte boundary.
+ */
+static uint8_t *build_image(FONT *font, int bpp, uint32_t *size_out)
+{
+	int		 levels = (1 << bpp) - 1;
+	uint32_t size = FBF_HDR_SIZE + font->char_count * FBF_GLYPH_SIZE;
+	int		 max_width = 0;
+
+	size = (size + 3) & ~3;
+	for (int i = 0; i < font->char_count; i++) {
+		GLYPH *g = &font->glyph[font->first_char + i];
+		if (g->present)
+			size += (g->width * bpp + 7) / 8 * font->height;
+	}
+
+	uint8_t *img = xcalloc(size);
+	uint32_t off = (FBF_HDR_SIZE + font->char_count * FBF_GLYPH_SIZE + 3) & ~3;
+
+	memcpy(img, FBF_MAGIC, 4);
+	img[4] = bpp;
+	img[5] = font->height;
+	img[7] = font->first_char;
+	put_le16(&img[8], font->char_count);
+	put_le16(&img[10], font->proportional ? FBF_FLAG_PROPORTIONAL : 0);
+	put_le32(&img[12], size);
+
+	for (int i = 0; i < font->char_count; i++) {
+		GLYPH	*g = &font->glyph[font->first_char + i];
+		uint8_t *ent = &img[FBF_HDR_SIZE + i * FBF_GLYPH_SIZE];
+		if (!g->present) {
+			/* missing glyphs render as blank zero-width cells */
+			put_le32(ent, off);
+			continue;
+		}
+		int stride = (g->width * bpp + 7) / 8;
+		/* the table entry holds them in a byte each */
+		if (g->width > 255 || g->advance < 0 || g->advance > 255 || stride > 255) {
+			char code[8];
+			snprintf(code, sizeof(code), "%d", font->first_char + i);
+			die("glyph %s: width, advance or stride above 255", code);
+		}
+		put_le32(ent, off);
+		ent[4] = g->width;
+		ent[5] = g->advance;
+		ent[6] = stride;
+		if (g->width > max_width)
+			max_width = g->width;
+		for (int y = 0; y < font->height; y++) {
+			for (int x = 0; x < g->width; x++) {
+				int v = (g->cov[y * g->width + x] * levels + 127) / 255;
+				int bitpos = x * bpp;
+				img[off + bitpos / 8] |= v << (8 - bpp - (bitpos % 8));
+			}
+			off += stride;
+		}
+	}
+	img[6] = max_width;
+	*size_out = size;
+	return img;
+}
+
+static void write_header(const char *fname, const char *name, const char *srcname,
+						 const uint8_t *img, uint32_t size)
+{
+	FILE *fp = fopen(fname, "w");
+	char  guard[128];
+	int	  i;
+
+	if (fp == NULL)
+		die("cannot write %s", fname);
+	for (i = 0; name[i] && i < (int)sizeof(guard) - 4; i++)
+		guard[i] = toupper((unsigned char)name[i]);
+	strcpy(&guard[i], "_H");
+
+	fprintf(fp, "/*\n"
+				" * %s: generated by fontconv from %s\n"
+				" * %dbpp, height %d, max width %d, chars 0x%02x-0x%02x, %u bytes\n"
+				" * Do not edit, regenerate with sw/fontconv instead.\n"
+				" */\n\n",
+			name, srcname, img[4], img[5], img[6], img[7],
+			img[7] + img[8] + (img[9] << 8) - 1, size);
+	fprintf(fp, "#ifndef _%s\n#define _%s\n\n#include \"fbfont.h\"\n\n", guard, guard);
+	fprintf(fp, "FBFONTDECL(%s) = {", name);
+	for (uint32_t n = 0; n < size; n++) {
+		fprintf(fp, "%s0x%02x,", (n % 16) ? " " : "\n\t", img[n]);
+	}
+	fprintf(fp, "\n};\n\n#endif\n");
+	fclose(fp);
+}
+
+/*
+ * Writes a $readmemh image for the hardware text layer font ROM: the 128
+ * ASCII chars of 16 rows, one 16-bit word per row with the leftmost pixel
+ * in bit 15. Rows below the font height and missing chars are blank.
+ */
+static void write_memh(const char *fname, const char *srcname, FONT *font)
+{
+	FILE *fp = fopen(fname, "w");
+
+	if (fp == NULL)
+		die("cannot write %s", fname);
+	fprintf(fp, "// generated by fontconv from %s, 128 chars x 16 rows x 16 bits\n", srcname);
+	for (int c = 0; c < 128; c++) {
+		GLYPH *g = &font->glyph[c];
+		for (int y = 0; y < 16; y++) {
+			unsigned row = 0;
+			if (g->present && y < font->height) {
+				for (int x = 0; x < g->width && x < 16; x++)
+					if (g->cov[y * g->width + x] >= 128)
+						row |= 0x8000 >> x;
+			}
+			fprintf(fp, "%04x%s", row, (y == 15) ? "\n" : " ");
+		}
+	}
+	fclose(fp);
+}
+
+static void usage(const char *prog)
+{
+	printf("Usage: %s [options] <font.h | font.bdf>\n"
+		   "    -b <1|2|4>    output bits per pixel (default 1)\n"
+		   "    -u <n>        upscale by n (pixel replication)\n"
+		   "    -d <n>        downsample by n with box filter (anti-aliasing)\n"
+		   "    -r <lo>-<hi>  only keep chars lo..hi (e.g. 0x20-0x7e)\n"
+		   "    -o <file>     write binary font image\n"
+		   "    -c <file>     write C header for compile-time inclusion\n"
+		   "    -n <name>     C array name (default fbf_font)\n"
+		   "    -m <file>     write text layer font ROM ($readmemh, 1bpp, 16x16 max)\n"
+		   "TTF/OTF: rasterize to BDF first (e.g. otf2bdf), then use -d.\n",
+		   prog);
+}
+
+int main(int argc, char *argv[])
+{
+	FONT	   *font = calloc(1, sizeof(FONT));
+	int			bpp = 1, up = 1, down = 1, lo = -1, hi = -1;
+	const char *binname = NULL, *hdrname = NULL, *name = "fbf_font";
+	const char *memhname = NULL;
+	const char *srcname = NULL;
+
+	for (int i = 1; i < argc; i++) {
+		if (argv[i][0] != '-') {
+			srcname = argv[i];
+			continue;
+		}
+		if (i + 1 >= argc) {
+			usage(argv[0]);
+			return -1;
+		}
+		switch (argv[i][1]) {
+		case 'b':
+			bpp = atoi(argv[++i]);
+			break;
+		case 'u':
+			up = atoi(argv[++i]);
+			break;
+		case 'd':
+			down = atoi(argv[++i]);
+			break;
+		case 'r':
+			if (sscanf(argv[++i], "%i-%i", &lo, &hi) != 2 || lo < 0 || lo > hi ||
+				hi >= MAX_GLYPHS)
+				die("bad range %s, want 0 <= lo <= hi <= 255", argv[i]);
+			break;
+		case 'o':
+			binname = argv[++i];
+			break;
+		case 'c':
+			hdrname = argv[++i];
+			break;
+		case 'n':
+			name = argv[++i];
+			break;
+		case 'm':
+			memhname = argv[++i];
+			break;
+		default:
+			usage(argv[0]);
+			return -1;
+		}
+	}
+	if (srcname == NULL || (binname == NULL && hdrname == NULL && memhname == NULL) ||
+		(bpp != 1 && bpp != 2 && bpp != 4) || up < 1 || down < 1) {
+		usage(argv[0]);
+		return -1;
+	}
+
+	const char *ext = strrchr(srcname, '.');
+	if (ext && strcasecmp(ext, ".bdf") == 0)
+		load_bdf(font, srcname);
+	else
+		load_glcd(font, srcname);
+
+	if (lo >= 0) {
+		for (int c = 0; c < MAX_GLYPHS; c++)
+			if (c < lo || c > hi)
+				font->glyph[c].present = 0;
+		font->first_char = lo;
+		font->char_count = hi - lo + 1;
+	}
+	if (up > 1)
+		upscale(font, up);
+	if (down > 1)
+		downsample(font, down);
+	if (font->height > 255)
+		die("%s: resulting font is taller than 255 rows", srcname);
+
+	uint32_t size;
+	uint8_t *img = build_image(font, bpp, &size);
+
+	printf("%s: %dbpp, height %d, max width %d, %d chars from 0x%02x, %u bytes\n",
+		   srcname, bpp, img[5], img[6], font->char_count, font->first_char, size);
+
+	if (binname) {
+		FILE *fp = fopen(binname, "wb");
+		if (fp == NULL || fwrite(img, 1, size, fp) != size)
+			die("cannot write %s", binname);
+		fclose(fp);
+	}
+	const char *base = strrchr(srcname, '/');
+	if (hdrname)
+		write_header(hdrname, name, base ? base + 1 : srcname, img, size);
+	if (memhname) {
+		if (font->height > 16 || img[6] > 16)
+			die("%s: text layer fonts are limited to 16x16 cells", srcname);
+		write_memh(memhname, base ? base + 1 : srcname, font);
+	}
+	return 0;
+}